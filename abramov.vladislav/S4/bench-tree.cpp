@@ -0,0 +1,48 @@
+#include <type_traits>
+#include <vector>
+#include <string>
+#include <bench.hpp>
+#include <binary_tree/binary_tree.hpp>
+
+namespace
+{
+  template< class Tree >
+  struct TreeTraits: bench::MapTraits< Tree >
+  {
+    static void insert(Tree &tree, int key)
+    {
+      tree.insert(key, key);
+    }
+  };
+
+  template< class Tree >
+  void runSortedInsert(const char *name, const bench::Options &opts)
+  {
+    constexpr size_t plain_limit = 1 << 16;
+    for (size_t n = opts.n / 8; n <= opts.n; n *= 2)
+    {
+      if ((!n) || (std::is_same< Tree, abramov::BinarySearchTree< int, int > >::value && n > plain_limit))
+      {
+        break;
+      }
+      const std::vector< int > keys = bench::sequentialKeys(n);
+      Tree tree;
+      bench::Probe probe(name, "insert_sorted_" + std::to_string(n));
+      for (int key: keys)
+      {
+        tree.insert(key, key);
+      }
+      probe.note("height", tree.height());
+      probe.stop(n);
+    }
+  }
+
+  using PlainTree = abramov::BinarySearchTree< int, int >;
+  using BalancedTree = abramov::BinarySearchTree< int, int, std::less< int >, true >;
+
+  const bench::Registrar plain("abramov::BinarySearchTree", bench::runMap< PlainTree, TreeTraits< PlainTree > >);
+  const bench::Registrar balanced("abramov::BinarySearchTree<balanced>",
+    bench::runMap< BalancedTree, TreeTraits< BalancedTree > >);
+  const bench::Registrar plain_sorted("abramov::BinarySearchTree", runSortedInsert< PlainTree >);
+  const bench::Registrar balanced_sorted("abramov::BinarySearchTree<balanced>", runSortedInsert< BalancedTree >);
+}
@@ -7,8 +7,8 @@
 
 namespace abramov
 {
-  using tree = BinarySearchTree< int, std::string >;
-  using collections = BinarySearchTree< std::string, tree >;
+  using tree = BinarySearchTree< int, std::string, std::less< int >, true >;
+  using collections = BinarySearchTree< std::string, tree, std::less< std::string >, true >;
   collections getDataSets(std::ifstream &in);
   void printDataSet(const std::string &s, const collections &dicts);
   void complementDataSets(const std::string &s, const std::string &s1, const std::string &s2, collections &dicts);
@@ -1,5 +1,5 @@
 #include <boost/test/unit_test.hpp>
-#include "binary_tree.hpp"
+#include <binary_tree/binary_tree.hpp>
 
 BOOST_AUTO_TEST_CASE(pre_increment_const)
 {
@@ -1,7 +1,7 @@
 #include <boost/test/unit_test.hpp>
 #include <boost/test/tools/detail/print_helper.hpp>
 #include <string>
-#include "binary_tree.hpp"
+#include <binary_tree/binary_tree.hpp>
 
 namespace boost::test_tools::tt_detail
 {
@@ -237,3 +237,77 @@ BOOST_AUTO_TEST_CASE(cequalrange)
   BOOST_TEST(p.first == p.second);
   BOOST_TEST(p.first == tree.cend());
 }
+
+BOOST_AUTO_TEST_CASE(height)
+{
+  abramov::BinarySearchTree< int, std::string > tree;
+  BOOST_TEST(tree.height() == 0);
+  for (int i = 0; i < 10; ++i)
+  {
+    tree.insert(i, "a");
+  }
+  BOOST_TEST(tree.height() == 10);
+}
+
+BOOST_AUTO_TEST_CASE(balanced_sorted_insert)
+{
+  abramov::BinarySearchTree< int, int, std::less< int >, true > tree;
+  for (int i = 0; i < 1023; ++i)
+  {
+    tree.insert(i, i);
+  }
+  BOOST_TEST(tree.size() == 1023);
+  BOOST_TEST(tree.height() == 10);
+  int expected = 0;
+  for (auto it = tree.cbegin(); it != tree.cend(); ++it)
+  {
+    BOOST_TEST(it->first == expected++);
+  }
+  BOOST_TEST(expected == 1023);
+}
+
+BOOST_AUTO_TEST_CASE(balanced_erase)
+{
+  abramov::BinarySearchTree< int, int, std::less< int >, true > tree;
+  for (int i = 0; i < 100; ++i)
+  {
+    tree.insert(i, i);
+  }
+  for (int i = 0; i < 100; i += 2)
+  {
+    tree.erase(i);
+  }
+  BOOST_TEST(tree.size() == 50);
+  BOOST_TEST(tree.height() <= 8);
+  BOOST_TEST(tree.count(2) == 0);
+  BOOST_TEST(tree.count(3) == 1);
+  for (int i = 1; i < 100; i += 2)
+  {
+    tree.erase(i);
+  }
+  BOOST_TEST(tree.empty());
+}
+
+BOOST_AUTO_TEST_CASE(balanced_copy_insert)
+{
+  abramov::BinarySearchTree< int, int, std::less< int >, true > tree;
+  for (int i = 0; i < 1023; ++i)
+  {
+    tree.insert(i, i);
+  }
+  abramov::BinarySearchTree< int, int, std::less< int >, true > copy(tree);
+  BOOST_TEST(copy.height() == 10);
+  for (int i = 1023; i < 2047; ++i)
+  {
+    copy.insert(i, i);
+  }
+  BOOST_TEST(copy.size() == 2047);
+  BOOST_TEST(copy.height() == 11);
+  BOOST_TEST(tree.height() == 10);
+  int expected = 0;
+  for (auto it = copy.cbegin(); it != copy.cend(); ++it)
+  {
+    BOOST_TEST(it->first == expected++);
+  }
+  BOOST_TEST(expected == 2047);
+}
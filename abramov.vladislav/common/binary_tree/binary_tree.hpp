@@ -3,6 +3,7 @@
 #include <queue>
 #include <cstddef>
 #include <algorithm>
+#include <utility>
 #include <functional>
 #include "node.hpp"
 #include "cIterator.hpp"
@@ -20,15 +21,15 @@ namespace abramov
   using crange_t = std::pair< ConstIterator< Key, Value >, ConstIterator< Key, Value > >;
 
 
- template< class Key, class Value, class Cmp = std::less< Key > >
+ template< class Key, class Value, class Cmp = std::less< Key >, bool Balanced = false >
   struct BinarySearchTree
   {
     using node_t = Node< Key, Value >;
-    using tree_t = BinarySearchTree< Key, Value, Cmp >;
+    using tree_t = BinarySearchTree< Key, Value, Cmp, Balanced >;
 
     BinarySearchTree();
-    BinarySearchTree(const BinarySearchTree< Key, Value, Cmp > &tree);
-    BinarySearchTree(BinarySearchTree< Key, Value, Cmp > &&tree) noexcept;
+    BinarySearchTree(const BinarySearchTree< Key, Value, Cmp, Balanced > &tree);
+    BinarySearchTree(BinarySearchTree< Key, Value, Cmp, Balanced > &&tree) noexcept;
     ~BinarySearchTree() noexcept;
     tree_t &operator=(const tree_t &tree);
     tree_t &operator=(tree_t &&tree) noexcept;
@@ -47,6 +48,7 @@ namespace abramov
     void erase(const Key &k) noexcept;
     size_t size() const noexcept;
     bool empty() const noexcept;
+    size_t height() const noexcept;
     void swap(BinarySearchTree &rhs) noexcept;
     void clear() noexcept;
     template< class F >
@@ -73,18 +75,24 @@ namespace abramov
     const Node< Key, Value > *cgetMin(const Node< Key, Value > *root) const noexcept;
     Node< Key, Value > *findNode(const Key &k) noexcept;
     const Node< Key, Value > *cfindNode(const Key &k) const noexcept;
+    size_t nodeHeight(const node_t *node) const noexcept;
+    void updateHeight(node_t *node) noexcept;
+    void replaceChild(node_t *parent, node_t *old_child, node_t *new_child) noexcept;
+    node_t *rotateLeft(node_t *node) noexcept;
+    node_t *rotateRight(node_t *node) noexcept;
+    void rebalance(node_t *node) noexcept;
   };
 
-  template< class Key, class Value, class Cmp >
-  BinarySearchTree< Key, Value, Cmp >::BinarySearchTree():
+  template< class Key, class Value, class Cmp, bool Balanced >
+  BinarySearchTree< Key, Value, Cmp, Balanced >::BinarySearchTree():
     root_(nullptr),
     fake_(new Node< Key, Value >),
     cmp_(Cmp()),
     size_(0)
   {}
 
-  template< class Key, class Value, class Cmp >
-  BinarySearchTree< Key, Value, Cmp >::BinarySearchTree(const BinarySearchTree< Key, Value, Cmp > &tree):
+  template< class Key, class Value, class Cmp, bool Balanced >
+  BinarySearchTree< Key, Value, Cmp, Balanced >::BinarySearchTree(const BinarySearchTree< Key, Value, Cmp, Balanced > &tree):
     root_(nullptr),
     fake_(new Node< Key, Value >),
     cmp_(tree.cmp_),
@@ -108,20 +116,20 @@ namespace abramov
     }
   }
 
-  template< class Key, class Value, class Cmp >
-  typename BinarySearchTree< Key, Value, Cmp >::tree_t&
-  BinarySearchTree< Key, Value, Cmp >::operator=(const tree_t &tree)
+  template< class Key, class Value, class Cmp, bool Balanced >
+  typename BinarySearchTree< Key, Value, Cmp, Balanced >::tree_t&
+  BinarySearchTree< Key, Value, Cmp, Balanced >::operator=(const tree_t &tree)
   {
     if (this != std::addressof(tree))
     {
-      BinarySearchTree< Key, Value, Cmp > tmp(tree);
+      BinarySearchTree< Key, Value, Cmp, Balanced > tmp(tree);
       swap(tmp);
     }
     return *this;
   }
 
-  template< class Key, class Value, class Cmp >
-  BinarySearchTree< Key, Value, Cmp >::BinarySearchTree(BinarySearchTree< Key, Value, Cmp > &&tree) noexcept:
+  template< class Key, class Value, class Cmp, bool Balanced >
+  BinarySearchTree< Key, Value, Cmp, Balanced >::BinarySearchTree(BinarySearchTree< Key, Value, Cmp, Balanced > &&tree) noexcept:
     root_(tree.root_),
     fake_(tree.fake_),
     cmp_(std::move(tree.cmp_)),
@@ -132,9 +140,9 @@ namespace abramov
     tree.size_ = 0;
   }
 
-  template< class Key, class Value, class Cmp >
-  typename BinarySearchTree< Key, Value, Cmp >::tree_t&
-  BinarySearchTree< Key, Value, Cmp >::operator=(tree_t &&tree) noexcept
+  template< class Key, class Value, class Cmp, bool Balanced >
+  typename BinarySearchTree< Key, Value, Cmp, Balanced >::tree_t&
+  BinarySearchTree< Key, Value, Cmp, Balanced >::operator=(tree_t &&tree) noexcept
   {
     if (this != std::addressof(tree))
     {
@@ -151,20 +159,19 @@ namespace abramov
     return *this;
   }
 
-  template< class Key, class Value, class Cmp >
-  BinarySearchTree< Key, Value, Cmp >::~BinarySearchTree() noexcept
+  template< class Key, class Value, class Cmp, bool Balanced >
+  BinarySearchTree< Key, Value, Cmp, Balanced >::~BinarySearchTree() noexcept
   {
     clear();
     delete fake_;
   }
 
-  template< class Key, class Value, class Cmp >
-  void BinarySearchTree< Key, Value, Cmp >::insert(const Key &key, const  Value &value)
+  template< class Key, class Value, class Cmp, bool Balanced >
+  void BinarySearchTree< Key, Value, Cmp, Balanced >::insert(const Key &key, const  Value &value)
   {
-    Node< Key, Value > *node = new Node< Key, Value >(std::make_pair(key, value), nullptr, fake_, fake_);
     if (empty())
     {
-      root_ = node;
+      root_ = new Node< Key, Value >(std::make_pair(key, value), nullptr, fake_, fake_);
       ++size_;
       return;
     }
@@ -181,8 +188,12 @@ namespace abramov
       {
         curr = curr->right_;
       }
+      else
+      {
+        return;
+      }
     }
-    node->parent_ = parent;
+    Node< Key, Value > *node = new Node< Key, Value >(std::make_pair(key, value), parent, fake_, fake_);
     if (cmp_(key, parent->data_.first))
     {
       parent->left_ = node;
@@ -192,10 +203,12 @@ namespace abramov
       parent->right_ = node;
     }
     ++size_;
+    rebalance(parent);
   }
 
-  template< class Key, class Value, class Cmp >
-  Value &BinarySearchTree< Key, Value, Cmp >::operator[](const Key &key) noexcept
+
+  template< class Key, class Value, class Cmp, bool Balanced >
+  Value &BinarySearchTree< Key, Value, Cmp, Balanced >::operator[](const Key &key) noexcept
   {
     if (empty())
     {
@@ -208,48 +221,48 @@ namespace abramov
     return find(key)->second;
   }
 
-  template< class Key, class Value, class Cmp >
-  Iterator< Key, Value > BinarySearchTree< Key, Value, Cmp >::begin()
+  template< class Key, class Value, class Cmp, bool Balanced >
+  Iterator< Key, Value > BinarySearchTree< Key, Value, Cmp, Balanced >::begin()
   {
     Node< Key, Value > *node = getMin(root_);
     return Iterator< Key, Value >(node, fake_, root_);
   }
 
-  template< class Key, class Value, class Cmp >
-  Iterator< Key, Value > BinarySearchTree< Key, Value, Cmp >::end()
+  template< class Key, class Value, class Cmp, bool Balanced >
+  Iterator< Key, Value > BinarySearchTree< Key, Value, Cmp, Balanced >::end()
   {
     return Iterator< Key, Value >(fake_, fake_, root_);
   }
 
-  template< class Key, class Value, class Cmp >
-  ConstIterator< Key, Value > BinarySearchTree< Key, Value, Cmp >::cbegin() const
+  template< class Key, class Value, class Cmp, bool Balanced >
+  ConstIterator< Key, Value > BinarySearchTree< Key, Value, Cmp, Balanced >::cbegin() const
   {
     const Node< Key, Value > *node = cgetMin(root_);
     return ConstIterator< Key, Value >(node, fake_, root_);
   }
 
-  template< class Key, class Value, class Cmp >
-  ConstIterator< Key, Value > BinarySearchTree< Key, Value, Cmp>::cend() const
+  template< class Key, class Value, class Cmp, bool Balanced >
+  ConstIterator< Key, Value > BinarySearchTree< Key, Value, Cmp, Balanced >::cend() const
   {
     return ConstIterator< Key, Value >(fake_, fake_, root_);
   }
 
-  template< class Key, class Value, class Cmp >
-  Iterator< Key, Value > BinarySearchTree< Key, Value, Cmp >::find(const Key &k) noexcept
+  template< class Key, class Value, class Cmp, bool Balanced >
+  Iterator< Key, Value > BinarySearchTree< Key, Value, Cmp, Balanced >::find(const Key &k) noexcept
   {
     Node< Key, Value > *node = findNode(k);
     return Iterator< Key, Value >(node, fake_, root_);
   }
 
-  template< class Key, class Value, class Cmp >
-  ConstIterator< Key, Value > BinarySearchTree< Key, Value, Cmp >::cfind(const Key &k) const noexcept
+  template< class Key, class Value, class Cmp, bool Balanced >
+  ConstIterator< Key, Value > BinarySearchTree< Key, Value, Cmp, Balanced >::cfind(const Key &k) const noexcept
   {
     const Node< Key, Value > *node = cfindNode(k);
     return ConstIterator< Key, Value >(node, fake_, root_);
   }
 
-  template< class Key, class Value, class Cmp >
-  size_t BinarySearchTree< Key, Value, Cmp >::count(const Key &k) const noexcept
+  template< class Key, class Value, class Cmp, bool Balanced >
+  size_t BinarySearchTree< Key, Value, Cmp, Balanced >::count(const Key &k) const noexcept
   {
     auto it = cend();
     if (cfind(k) != cend())
@@ -259,8 +272,8 @@ namespace abramov
     return 0;
   }
 
-  template< class Key, class Value, class Cmp >
-  range_t< Key, Value > BinarySearchTree< Key, Value, Cmp >::equal_range(const Key &k) noexcept
+  template< class Key, class Value, class Cmp, bool Balanced >
+  range_t< Key, Value > BinarySearchTree< Key, Value, Cmp, Balanced >::equal_range(const Key &k) noexcept
   {
     Iterator< Key, Value > iter = find(k);
     if (iter == end())
@@ -270,8 +283,8 @@ namespace abramov
     return std::make_pair(iter, ++iter);
   }
 
-  template< class Key, class Value, class Cmp >
-  crange_t< Key, Value > BinarySearchTree< Key, Value, Cmp >::cequal_range(const Key &k) const noexcept
+  template< class Key, class Value, class Cmp, bool Balanced >
+  crange_t< Key, Value > BinarySearchTree< Key, Value, Cmp, Balanced >::cequal_range(const Key &k) const noexcept
   {
     ConstIterator< Key, Value > c_iter = cfind(k);
     if (c_iter == cend())
@@ -281,8 +294,8 @@ namespace abramov
     return std::make_pair(c_iter, ++c_iter);
   }
 
-  template< class Key, class Value, class Cmp >
-  void BinarySearchTree< Key, Value, Cmp >::erase(Iterator< Key, Value > pos) noexcept
+  template< class Key, class Value, class Cmp, bool Balanced >
+  void BinarySearchTree< Key, Value, Cmp, Balanced >::erase(Iterator< Key, Value > pos) noexcept
   {
     if (pos == end())
     {
@@ -309,6 +322,7 @@ namespace abramov
       }
       delete node;
       --size_;
+      rebalance(parent);
       return;
     }
     if (node->left_ == fake_ || node->right_ == fake_)
@@ -333,6 +347,7 @@ namespace abramov
       }
       delete node;
       --size_;
+      rebalance(parent);
       return;
     }
     Node< Key, Value > *successor = node->right_;
@@ -345,27 +360,55 @@ namespace abramov
     node->data_ = data;
   }
 
-  template< class Key, class Value, class Cmp >
-  void BinarySearchTree< Key, Value, Cmp >::erase(const Key &k) noexcept
+  template< class Key, class Value, class Cmp, bool Balanced >
+  void BinarySearchTree< Key, Value, Cmp, Balanced >::erase(const Key &k) noexcept
   {
     Iterator< Key, Value > pos = find(k);
     erase(pos);
   }
 
-  template< class Key, class Value, class Cmp >
-  size_t BinarySearchTree< Key, Value, Cmp >::size() const noexcept
+  template< class Key, class Value, class Cmp, bool Balanced >
+  size_t BinarySearchTree< Key, Value, Cmp, Balanced >::size() const noexcept
   {
     return size_;
   }
 
-  template< class Key, class Value, class Cmp >
-  bool BinarySearchTree< Key, Value, Cmp >::empty() const noexcept
+  template< class Key, class Value, class Cmp, bool Balanced >
+  bool BinarySearchTree< Key, Value, Cmp, Balanced >::empty() const noexcept
   {
     return size_ == 0;
   }
 
-  template< class Key, class Value, class Cmp >
-  void BinarySearchTree< Key, Value, Cmp >::swap(BinarySearchTree< Key, Value, Cmp > &rhs) noexcept
+  template< class Key, class Value, class Cmp, bool Balanced >
+  size_t BinarySearchTree< Key, Value, Cmp, Balanced >::height() const noexcept
+  {
+    if (Balanced || empty())
+    {
+      return nodeHeight(root_);
+    }
+    size_t res = 0;
+    std::queue< std::pair< const node_t*, size_t > > q;
+    q.push(std::make_pair(root_, 1));
+    while (!q.empty())
+    {
+      const node_t *curr = q.front().first;
+      size_t depth = q.front().second;
+      q.pop();
+      res = std::max(res, depth);
+      if (curr->left_ != fake_)
+      {
+        q.push(std::make_pair(curr->left_, depth + 1));
+      }
+      if (curr->right_ != fake_)
+      {
+        q.push(std::make_pair(curr->right_, depth + 1));
+      }
+    }
+    return res;
+  }
+
+  template< class Key, class Value, class Cmp, bool Balanced >
+  void BinarySearchTree< Key, Value, Cmp, Balanced >::swap(BinarySearchTree< Key, Value, Cmp, Balanced > &rhs) noexcept
   {
     std::swap(root_, rhs.root_);
     std::swap(fake_, rhs.fake_);
@@ -373,28 +416,38 @@ namespace abramov
     std::swap(size_, rhs.size_);
   }
 
-  template< class Key, class Value, class Cmp >
-  void BinarySearchTree< Key, Value, Cmp >::clearNodes(Node< Key, Value > *root) noexcept
+  template< class Key, class Value, class Cmp, bool Balanced >
+  void BinarySearchTree< Key, Value, Cmp, Balanced >::clearNodes(Node< Key, Value > *root) noexcept
   {
-    if (root != fake_ && root)
+    while (root && root != fake_)
     {
-      clearNodes(root->left_);
-      clearNodes(root->right_);
-      delete root;
+      if (root->left_ != fake_)
+      {
+        root = std::exchange(root->left_, fake_);
+      }
+      else if (root->right_ != fake_)
+      {
+        root = std::exchange(root->right_, fake_);
+      }
+      else
+      {
+        delete std::exchange(root, root->parent_);
+      }
     }
   }
 
-  template< class Key, class Value, class Cmp >
-  void BinarySearchTree< Key, Value, Cmp >::clear() noexcept
+
+  template< class Key, class Value, class Cmp, bool Balanced >
+  void BinarySearchTree< Key, Value, Cmp, Balanced >::clear() noexcept
   {
     clearNodes(root_);
     size_ = 0;
     root_ = nullptr;
   }
 
-  template< class Key, class Value, class Cmp >
-  typename BinarySearchTree< Key, Value, Cmp >::node_t*
-  BinarySearchTree< Key, Value, Cmp >::copyTree(node_t *node, node_t *parent, node_t *old_fake, node_t *fake)
+  template< class Key, class Value, class Cmp, bool Balanced >
+  typename BinarySearchTree< Key, Value, Cmp, Balanced >::node_t*
+  BinarySearchTree< Key, Value, Cmp, Balanced >::copyTree(node_t *node, node_t *parent, node_t *old_fake, node_t *fake)
   {
     if (!node || node == old_fake)
     {
@@ -404,6 +457,7 @@ namespace abramov
     try
     {
       new_node = new Node< Key, Value >(node->data_, parent, fake, fake);
+      new_node->height_ = node->height_;
       new_node->left_ = copyTree(node->left_, new_node, old_fake, fake);
       new_node->right_ = copyTree(node->right_, new_node, old_fake, fake);
     }
@@ -415,8 +469,107 @@ namespace abramov
     return new_node;
   }
 
-  template< class Key, class Value, class Cmp >
-  const Node< Key, Value > *BinarySearchTree< Key, Value, Cmp >::cgetMin(const Node< Key, Value > *root) const noexcept
+  template< class Key, class Value, class Cmp, bool Balanced >
+  size_t BinarySearchTree< Key, Value, Cmp, Balanced >::nodeHeight(const node_t *node) const noexcept
+  {
+    return (!node || node == fake_) ? 0 : node->height_;
+  }
+
+  template< class Key, class Value, class Cmp, bool Balanced >
+  void BinarySearchTree< Key, Value, Cmp, Balanced >::updateHeight(node_t *node) noexcept
+  {
+    node->height_ = 1 + std::max(nodeHeight(node->left_), nodeHeight(node->right_));
+  }
+
+  template< class Key, class Value, class Cmp, bool Balanced >
+  void BinarySearchTree< Key, Value, Cmp, Balanced >::replaceChild(node_t *parent, node_t *old_child,
+    node_t *new_child) noexcept
+  {
+    new_child->parent_ = parent;
+    if (!parent)
+    {
+      root_ = new_child;
+    }
+    else if (parent->left_ == old_child)
+    {
+      parent->left_ = new_child;
+    }
+    else
+    {
+      parent->right_ = new_child;
+    }
+  }
+
+  template< class Key, class Value, class Cmp, bool Balanced >
+  typename BinarySearchTree< Key, Value, Cmp, Balanced >::node_t*
+  BinarySearchTree< Key, Value, Cmp, Balanced >::rotateLeft(node_t *node) noexcept
+  {
+    node_t *pivot = node->right_;
+    node->right_ = pivot->left_;
+    if (pivot->left_ != fake_)
+    {
+      pivot->left_->parent_ = node;
+    }
+    replaceChild(node->parent_, node, pivot);
+    pivot->left_ = node;
+    node->parent_ = pivot;
+    updateHeight(node);
+    updateHeight(pivot);
+    return pivot;
+  }
+
+  template< class Key, class Value, class Cmp, bool Balanced >
+  typename BinarySearchTree< Key, Value, Cmp, Balanced >::node_t*
+  BinarySearchTree< Key, Value, Cmp, Balanced >::rotateRight(node_t *node) noexcept
+  {
+    node_t *pivot = node->left_;
+    node->left_ = pivot->right_;
+    if (pivot->right_ != fake_)
+    {
+      pivot->right_->parent_ = node;
+    }
+    replaceChild(node->parent_, node, pivot);
+    pivot->right_ = node;
+    node->parent_ = pivot;
+    updateHeight(node);
+    updateHeight(pivot);
+    return pivot;
+  }
+
+  template< class Key, class Value, class Cmp, bool Balanced >
+  void BinarySearchTree< Key, Value, Cmp, Balanced >::rebalance(node_t *node) noexcept
+  {
+    if (!Balanced)
+    {
+      return;
+    }
+    while (node)
+    {
+      updateHeight(node);
+      size_t left = nodeHeight(node->left_);
+      size_t right = nodeHeight(node->right_);
+      if (left > right + 1)
+      {
+        if (nodeHeight(node->left_->left_) < nodeHeight(node->left_->right_))
+        {
+          rotateLeft(node->left_);
+        }
+        node = rotateRight(node);
+      }
+      else if (right > left + 1)
+      {
+        if (nodeHeight(node->right_->right_) < nodeHeight(node->right_->left_))
+        {
+          rotateRight(node->right_);
+        }
+        node = rotateLeft(node);
+      }
+      node = node->parent_;
+    }
+  }
+
+  template< class Key, class Value, class Cmp, bool Balanced >
+  const Node< Key, Value > *BinarySearchTree< Key, Value, Cmp, Balanced >::cgetMin(const Node< Key, Value > *root) const noexcept
   {
     if (empty())
     {
@@ -429,15 +582,15 @@ namespace abramov
     return root;
   }
 
-  template< class Key, class Value, class Cmp >
-  Node< Key, Value > *BinarySearchTree< Key, Value, Cmp >::getMin(Node< Key, Value > *root) noexcept
+  template< class Key, class Value, class Cmp, bool Balanced >
+  Node< Key, Value > *BinarySearchTree< Key, Value, Cmp, Balanced >::getMin(Node< Key, Value > *root) noexcept
   {
-    using Tree = BinarySearchTree< Key, Value, Cmp >;
+    using Tree = BinarySearchTree< Key, Value, Cmp, Balanced >;
     return const_cast< Node< Key, Value >* >(const_cast< Tree* >(this)->cgetMin(root));
   }
 
-  template< class Key, class Value, class Cmp >
-  const Node< Key, Value > *BinarySearchTree< Key, Value, Cmp >::cfindNode(const Key &k) const noexcept
+  template< class Key, class Value, class Cmp, bool Balanced >
+  const Node< Key, Value > *BinarySearchTree< Key, Value, Cmp, Balanced >::cfindNode(const Key &k) const noexcept
   {
     const Node< Key, Value > *root = root_;
     while (root && root != fake_)
@@ -458,16 +611,16 @@ namespace abramov
     return fake_;
   }
 
-  template< class Key, class Value, class Cmp >
-  Node< Key, Value > *BinarySearchTree< Key, Value, Cmp >::findNode(const Key &k) noexcept
+  template< class Key, class Value, class Cmp, bool Balanced >
+  Node< Key, Value > *BinarySearchTree< Key, Value, Cmp, Balanced >::findNode(const Key &k) noexcept
   {
-    using Tree = BinarySearchTree< Key, Value, Cmp >;
+    using Tree = BinarySearchTree< Key, Value, Cmp, Balanced >;
     return const_cast< Node< Key, Value >* >(const_cast< Tree* >(this)->cfindNode(k));
   }
 
-  template< class Key, class Value, class Cmp >
+  template< class Key, class Value, class Cmp, bool Balanced >
   template< class F >
-  F BinarySearchTree< Key, Value, Cmp >::traverse_lnr(F f) const
+  F BinarySearchTree< Key, Value, Cmp, Balanced >::traverse_lnr(F f) const
   {
     if (empty())
     {
@@ -480,16 +633,16 @@ namespace abramov
     return f;
   }
 
-  template< class Key, class Value, class Cmp >
+  template< class Key, class Value, class Cmp, bool Balanced >
   template< class F >
-  F BinarySearchTree< Key, Value, Cmp >::traverse_lnr(F f)
+  F BinarySearchTree< Key, Value, Cmp, Balanced >::traverse_lnr(F f)
   {
-    return const_cast< const BinarySearchTree< Key, Value, Cmp >* >(this)->traverse_lnr(f);
+    return const_cast< const BinarySearchTree< Key, Value, Cmp, Balanced >* >(this)->traverse_lnr(f);
   }
 
-  template< class Key, class Value, class Cmp >
+  template< class Key, class Value, class Cmp, bool Balanced >
   template< class F >
-  F BinarySearchTree< Key, Value, Cmp >::traverse_rnl(F f) const
+  F BinarySearchTree< Key, Value, Cmp, Balanced >::traverse_rnl(F f) const
   {
     if (empty())
     {
@@ -503,16 +656,16 @@ namespace abramov
     return f;
   }
 
-  template< class Key, class Value, class Cmp >
+  template< class Key, class Value, class Cmp, bool Balanced >
   template< class F >
-  F BinarySearchTree< Key, Value, Cmp >::traverse_rnl(F f)
+  F BinarySearchTree< Key, Value, Cmp, Balanced >::traverse_rnl(F f)
   {
-    return const_cast< const BinarySearchTree< Key, Value, Cmp >* >(this)->traverse_rnl(f);
+    return const_cast< const BinarySearchTree< Key, Value, Cmp, Balanced >* >(this)->traverse_rnl(f);
   }
 
-  template< class Key, class Value, class Cmp >
+  template< class Key, class Value, class Cmp, bool Balanced >
   template< class F >
-  F BinarySearchTree< Key, Value, Cmp >::traverse_breadth(F f) const
+  F BinarySearchTree< Key, Value, Cmp, Balanced >::traverse_breadth(F f) const
   {
     if (empty())
     {
@@ -540,11 +693,11 @@ namespace abramov
     return f;
   }
 
-  template< class Key, class Value, class Cmp >
+  template< class Key, class Value, class Cmp, bool Balanced >
   template< class F >
-  F BinarySearchTree< Key, Value, Cmp >::traverse_breadth(F f)
+  F BinarySearchTree< Key, Value, Cmp, Balanced >::traverse_breadth(F f)
   {
-    return const_cast< const BinarySearchTree< Key, Value, Cmp >* >(this)->traverse_breadth(f);
+    return const_cast< const BinarySearchTree< Key, Value, Cmp, Balanced >* >(this)->traverse_breadth(f);
   }
 }
 #endif
@@ -48,11 +48,7 @@ namespace abramov
   template< class Key, class Value >
   ConstIterator< Key, Value > &ConstIterator< Key, Value >::operator++() noexcept
   {
-    if (node_ == cgetMax(root_))
-    {
-      node_ = fake_;
-    }
-    else if (node_->right_ != fake_)
+    if (node_->right_ != fake_)
     {
       node_ = node_->right_;
       while (node_->left_ != fake_)
@@ -68,7 +64,7 @@ namespace abramov
         node_ = parent;
         parent = parent->parent_;
       }
-      node_ = parent;
+      node_ = parent ? parent : fake_;
     }
     return *this;
   }
@@ -6,7 +6,7 @@
 
 namespace abramov
 {
-  template< class Key, class Value, class Cmp >
+  template< class Key, class Value, class Cmp, bool Balanced >
   struct BinarySearchTree;
 
   template< class Key, class Value >
@@ -30,7 +30,7 @@ namespace abramov
     Node< Key, Value > *fake_;
     Node< Key, Value > *root_;
 
-    template< class K, class V, class C >
+    template< class K, class V, class C, bool B >
     friend struct BinarySearchTree;
     Node< Key, Value > *getMax(Node< Key, Value > *root) noexcept;
   };
@@ -68,7 +68,7 @@ namespace abramov
         node_ = parent;
         parent = parent->parent_;
       }
-      node_ = parent;
+      node_ = parent ? parent : fake_;
     }
     return *this;
   }
@@ -12,6 +12,7 @@ namespace abramov
     Node< Key, Value > *parent_;
     Node< Key, Value > *left_;
     Node< Key, Value > *right_;
+    size_t height_;
 
     Node();
     Node(std::pair< Key, Value > data, Node< Key, Value > *p, Node< Key, Value > *l, Node< Key, Value > *r);
@@ -23,7 +24,8 @@ namespace abramov
     data_(std::pair< Key, Value >()),
     parent_(nullptr),
     left_(nullptr),
-    right_(nullptr)
+    right_(nullptr),
+    height_(1)
   {}
 
   template< class Key, class Value >
@@ -31,7 +33,8 @@ namespace abramov
     data_(d),
     parent_(p),
     left_(l),
-    right_(r)
+    right_(r),
+    height_(1)
   {}
 
   template< class Key, class Value >
@@ -39,7 +42,8 @@ namespace abramov
     data_(p),
     parent_(parent),
     left_(parent->left_),
-    right_(parent->right_)
+    right_(parent->right_),
+    height_(1)
   {}
 }
 #endif
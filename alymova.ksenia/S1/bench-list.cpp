@@ -0,0 +1,7 @@
+#include <bench.hpp>
+#include <list/list.hpp>
+
+namespace
+{
+  const bench::Registrar list("alymova::List", bench::runSequence< alymova::List< int > >);
+}
@@ -0,0 +1,9 @@
+#include <functional>
+#include <bench.hpp>
+#include <tree/tree-2-3.hpp>
+
+namespace
+{
+  using Tree = alymova::TwoThreeTree< int, int, std::less< int > >;
+  const bench::Registrar tree("alymova::TwoThreeTree", bench::runMap< Tree >);
+}
@@ -0,0 +1,196 @@
+#include "bench.hpp"
+#include <cstdlib>
+#include <cstring>
+#include <atomic>
+#include <new>
+#include <random>
+#include <fstream>
+#include <iostream>
+#include <memory>
+#include <sys/resource.h>
+
+namespace
+{
+  std::atomic< size_t > allocations(0);
+  volatile long long sink = 0;
+
+  struct Entry
+  {
+    const char* container;
+    bench::Suite suite;
+  };
+
+  std::vector< Entry >& registry()
+  {
+    static std::vector< Entry > entries;
+    return entries;
+  }
+
+  void* allocate(size_t size)
+  {
+    allocations.fetch_add(1, std::memory_order_relaxed);
+    void* ptr = std::malloc(size == 0 ? 1 : size);
+    if (!ptr)
+    {
+      throw std::bad_alloc();
+    }
+    return ptr;
+  }
+
+  void resetPeakRss()
+  {
+    std::ofstream clearRefs("/proc/self/clear_refs");
+    clearRefs << "5";
+  }
+
+  long peakRssKb()
+  {
+    std::ifstream status("/proc/self/status");
+    std::string field;
+    while (status >> field)
+    {
+      if (field == "VmHWM:")
+      {
+        long kb = 0;
+        status >> kb;
+        return kb;
+      }
+    }
+    rusage usage{};
+    getrusage(RUSAGE_SELF, std::addressof(usage));
+    return usage.ru_maxrss;
+  }
+}
+
+void* operator new(size_t size)
+{
+  return allocate(size);
+}
+
+void* operator new[](size_t size)
+{
+  return allocate(size);
+}
+
+void operator delete(void* ptr) noexcept
+{
+  std::free(ptr);
+}
+
+void operator delete[](void* ptr) noexcept
+{
+  std::free(ptr);
+}
+
+void operator delete(void* ptr, size_t) noexcept
+{
+  std::free(ptr);
+}
+
+void operator delete[](void* ptr, size_t) noexcept
+{
+  std::free(ptr);
+}
+
+bench::Registrar::Registrar(const char* container, Suite suite)
+{
+  registry().push_back({ container, suite });
+}
+
+size_t bench::allocationCount() noexcept
+{
+  return allocations.load(std::memory_order_relaxed);
+}
+
+void bench::keep(long long value) noexcept
+{
+  sink = sink + value;
+}
+
+bench::Probe::Probe(const char* container, std::string workload):
+  container_(container),
+  workload_(std::move(workload)),
+  notes_(),
+  allocs_(0),
+  start_()
+{
+  resetPeakRss();
+  allocs_ = allocationCount();
+  start_ = std::chrono::steady_clock::now();
+}
+
+void bench::Probe::note(const char* key, long long value)
+{
+  size_t before = allocationCount();
+  notes_ += ",\"" + std::string(key) + "\":" + std::to_string(value);
+  allocs_ += allocationCount() - before;
+}
+
+void bench::Probe::stop(size_t ops)
+{
+  auto end = std::chrono::steady_clock::now();
+  size_t allocs = allocationCount() - allocs_;
+  double ns = std::chrono::duration< double, std::nano >(end - start_).count();
+  std::cout << "{\"container\":\"" << container_ << "\",\"workload\":\"" << workload_ << "\"";
+  std::cout << ",\"ops\":" << ops << ",\"ns_per_op\":" << (ops ? ns / ops : ns);
+  std::cout << ",\"peak_rss_kb\":" << peakRssKb() << ",\"allocs\":" << allocs << notes_ << "}\n";
+}
+
+std::vector< int > bench::sequentialKeys(size_t n)
+{
+  std::vector< int > keys(n);
+  for (size_t i = 0; i < n; ++i)
+  {
+    keys[i] = static_cast< int >(i);
+  }
+  return keys;
+}
+
+std::vector< int > bench::shuffledKeys(size_t n)
+{
+  std::vector< int > keys = sequentialKeys(n);
+  std::mt19937 gen(20250101);
+  std::shuffle(keys.begin(), keys.end(), gen);
+  return keys;
+}
+
+std::vector< int > bench::missingKeys(size_t n)
+{
+  std::vector< int > keys = shuffledKeys(n);
+  for (int& key: keys)
+  {
+    key += static_cast< int >(n);
+  }
+  return keys;
+}
+
+int main(int argc, char** argv)
+{
+  bench::Options opts{ 100000, "" };
+  for (int i = 1; i < argc; ++i)
+  {
+    if (std::strcmp(argv[i], "-n") == 0 && i + 1 < argc)
+    {
+      opts.n = std::strtoull(argv[++i], nullptr, 10);
+    }
+    else
+    {
+      opts.filter = argv[i];
+    }
+  }
+  try
+  {
+    for (const Entry& entry: registry())
+    {
+      if (opts.filter.empty() || std::strstr(entry.container, opts.filter.c_str()))
+      {
+        entry.suite(entry.container, opts);
+      }
+    }
+  }
+  catch (const std::exception& e)
+  {
+    std::cerr << e.what() << "\n";
+    return 1;
+  }
+}
@@ -0,0 +1,248 @@
+#ifndef BENCH_HPP
+#define BENCH_HPP
+#include <cstddef>
+#include <algorithm>
+#include <chrono>
+#include <string>
+#include <vector>
+#include <utility>
+
+namespace bench
+{
+  struct Options
+  {
+    size_t n;
+    std::string filter;
+  };
+
+  using Suite = void (*)(const char*, const Options&);
+
+  struct Registrar
+  {
+    Registrar(const char* container, Suite suite);
+  };
+
+  size_t allocationCount() noexcept;
+  void keep(long long) noexcept;
+
+  class Probe
+  {
+  public:
+    Probe(const char* container, std::string workload);
+    void note(const char* key, long long value);
+    void stop(size_t ops);
+
+  private:
+    const char* container_;
+    std::string workload_;
+    std::string notes_;
+    size_t allocs_;
+    std::chrono::steady_clock::time_point start_;
+  };
+
+  std::vector< int > sequentialKeys(size_t n);
+  std::vector< int > shuffledKeys(size_t n);
+  std::vector< int > missingKeys(size_t n);
+
+  template< typename Map >
+  struct MapTraits
+  {
+    static void insert(Map& map, int key)
+    {
+      map.insert(std::make_pair(key, key));
+    }
+
+    static bool contains(Map& map, int key)
+    {
+      return map.find(key) != map.end();
+    }
+
+    static void erase(Map& map, int key)
+    {
+      map.erase(key);
+    }
+
+    static long long sum(Map& map)
+    {
+      long long res = 0;
+      for (auto it = map.begin(); it != map.end(); ++it)
+      {
+        res += it->second;
+      }
+      return res;
+    }
+  };
+
+  template< typename Seq >
+  struct SequenceTraits
+  {
+    static void push(Seq& seq, int value)
+    {
+      seq.push_back(value);
+    }
+
+    static void pop(Seq& seq)
+    {
+      seq.pop_front();
+    }
+
+    static bool contains(Seq& seq, int value)
+    {
+      for (auto it = seq.begin(); it != seq.end(); ++it)
+      {
+        if (*it == value)
+        {
+          return true;
+        }
+      }
+      return false;
+    }
+
+    static long long sum(Seq& seq)
+    {
+      long long res = 0;
+      for (auto it = seq.begin(); it != seq.end(); ++it)
+      {
+        res += *it;
+      }
+      return res;
+    }
+  };
+
+  template< typename Map, typename Traits = MapTraits< Map > >
+  void runMap(const char* name, const Options& opts)
+  {
+    const std::vector< int > seq = sequentialKeys(opts.n);
+    const std::vector< int > shuffled = shuffledKeys(opts.n);
+    const std::vector< int > missing = missingKeys(opts.n);
+    {
+      Map map;
+      Probe probe(name, "insert_seq");
+      for (int key: seq)
+      {
+        Traits::insert(map, key);
+      }
+      probe.stop(opts.n);
+    }
+
+    Map map;
+    Probe insertRand(name, "insert_rand");
+    for (int key: shuffled)
+    {
+      Traits::insert(map, key);
+    }
+    insertRand.stop(opts.n);
+
+    long long hits = 0;
+    Probe findHit(name, "find_hit");
+    for (int key: shuffled)
+    {
+      hits += Traits::contains(map, key);
+    }
+    findHit.stop(opts.n);
+
+    Probe findMiss(name, "find_miss");
+    for (int key: missing)
+    {
+      hits += Traits::contains(map, key);
+    }
+    findMiss.stop(opts.n);
+    keep(hits);
+
+    Probe iterate(name, "iterate");
+    keep(Traits::sum(map));
+    iterate.stop(opts.n);
+    {
+      Probe copy(name, "copy");
+      Map other(map);
+      copy.stop(opts.n);
+      keep(Traits::contains(other, 0));
+    }
+
+    Probe erase(name, "erase");
+    for (int key: shuffled)
+    {
+      Traits::erase(map, key);
+    }
+    erase.stop(opts.n);
+  }
+
+  template< typename Map, typename Traits = MapTraits< Map > >
+  void runChurn(const char* name, const Options& opts)
+  {
+    const size_t rounds = 8;
+    const size_t live = std::min< size_t >(opts.n, 1 << 13);
+    const size_t batch = std::max< size_t >(live / 4, 1);
+    Map map;
+    for (size_t i = 0; i < live; ++i)
+    {
+      Traits::insert(map, static_cast< int >(i));
+    }
+
+    int oldest = 0;
+    int next = static_cast< int >(live);
+    for (size_t round = 0; round < rounds; ++round)
+    {
+      long long hits = 0;
+      Probe churn(name, "churn_" + std::to_string(round));
+      for (size_t i = 0; i < batch; ++i)
+      {
+        Traits::erase(map, oldest++);
+        Traits::insert(map, next++);
+        hits += Traits::contains(map, oldest - 1);
+        hits += Traits::contains(map, next - 1);
+      }
+      churn.stop(batch);
+      keep(hits);
+    }
+  }
+
+  template< typename Seq, typename Traits = SequenceTraits< Seq > >
+  void runSequence(const char* name, const Options& opts)
+  {
+    const std::vector< int > shuffled = shuffledKeys(opts.n);
+    const size_t probes = std::min< size_t >(opts.n, 1000);
+    Seq seq;
+    Probe insert(name, "insert_seq");
+    for (int value: shuffled)
+    {
+      Traits::push(seq, value);
+    }
+    insert.stop(opts.n);
+
+    long long hits = 0;
+    Probe findHit(name, "find_hit");
+    for (size_t i = 0; i < probes; ++i)
+    {
+      hits += Traits::contains(seq, shuffled[i]);
+    }
+    findHit.stop(probes);
+
+    Probe findMiss(name, "find_miss");
+    for (size_t i = 0; i < probes; ++i)
+    {
+      hits += Traits::contains(seq, -1 - static_cast< int >(i));
+    }
+    findMiss.stop(probes);
+    keep(hits);
+
+    Probe iterate(name, "iterate");
+    keep(Traits::sum(seq));
+    iterate.stop(opts.n);
+    {
+      Probe copy(name, "copy");
+      Seq other(seq);
+      copy.stop(opts.n);
+      keep(Traits::sum(other));
+    }
+
+    Probe erase(name, "erase");
+    for (size_t i = 0; i < opts.n; ++i)
+    {
+      Traits::pop(seq);
+    }
+    erase.stop(opts.n);
+  }
+}
+
+#endif
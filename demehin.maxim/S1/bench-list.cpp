@@ -0,0 +1,10 @@
+#include <bench.hpp>
+#include <list/list.hpp>
+
+namespace
+{
+  using PooledList = demehin::List< int, demehin::PoolAllocator< int > >;
+
+  const bench::Registrar list("demehin::List", bench::runSequence< demehin::List< int > >);
+  const bench::Registrar pooled("demehin::List<pool>", bench::runSequence< PooledList >);
+}
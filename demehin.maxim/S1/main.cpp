@@ -7,7 +7,7 @@
 
 namespace
 {
-  using ListOfUll = demehin::List< unsigned long long >;
+  using ListOfUll = demehin::List< unsigned long long, demehin::PoolAllocator< unsigned long long > >;
   using ListOfPairs = demehin::List< std::pair< std::string, ListOfUll > >;
 
   size_t defineMaxSize(const ListOfPairs& pairsList)
@@ -1,11 +1,16 @@
 #include <boost/test/unit_test.hpp>
+#include <boost/mpl/list.hpp>
 #include <sstream>
+#include <string>
+#include <vector>
 #include <list/list.hpp>
 
 namespace
 {
-  template< typename T >
-  std::ostream& printList(std::ostream& out, demehin::List< T > lst)
+  using IntLists = boost::mpl::list< demehin::List< int >, demehin::List< int, demehin::PoolAllocator< int > > >;
+
+  template< typename List >
+  std::ostream& printList(std::ostream& out, List lst)
   {
     for (auto it = lst.begin(); it != lst.end(); it++)
     {
@@ -15,20 +20,20 @@ namespace
   }
 }
 
-BOOST_AUTO_TEST_CASE(list_construct_test)
+BOOST_AUTO_TEST_CASE_TEMPLATE(list_construct_test, IntList, IntLists)
 {
-  demehin::List< int > list;
-  demehin::List< int > fill_list(5ull, 5);
-  demehin::List< int > mov_list(std::move(list));
-  demehin::List< int > cop_list(mov_list);
+  IntList list;
+  IntList fill_list(5ull, 5);
+  IntList mov_list(std::move(list));
+  IntList cop_list(mov_list);
   std::initializer_list< int > ilist;
-  demehin::List< int > init_list(ilist);
-  demehin::List< int > range_list(fill_list.begin(), fill_list.end());
+  IntList init_list(ilist);
+  IntList range_list(fill_list.begin(), fill_list.end());
 }
 
-BOOST_AUTO_TEST_CASE(list_iter_test)
+BOOST_AUTO_TEST_CASE_TEMPLATE(list_iter_test, IntList, IntLists)
 {
-  demehin::List< int > list;
+  IntList list;
   list.push_back(5);
   list.push_back(4);
   list.push_back(5);
@@ -38,9 +43,9 @@ BOOST_AUTO_TEST_CASE(list_iter_test)
   BOOST_TEST(out.str() == "545");
 }
 
-BOOST_AUTO_TEST_CASE(list_el_access_test)
+BOOST_AUTO_TEST_CASE_TEMPLATE(list_el_access_test, IntList, IntLists)
 {
-  demehin::List< int > list;
+  IntList list;
   list.push_back(1);
   list.push_back(2);
   list.push_back(3);
@@ -48,18 +53,18 @@ BOOST_AUTO_TEST_CASE(list_el_access_test)
   BOOST_TEST(list.back() == 3);
 }
 
-BOOST_AUTO_TEST_CASE(list_capac_test)
+BOOST_AUTO_TEST_CASE_TEMPLATE(list_capac_test, IntList, IntLists)
 {
-  demehin::List< int > list;
+  IntList list;
   BOOST_TEST(list.empty());
   list.assign(5ull, 5);
   BOOST_TEST(list.size() == 5);
 }
 
-BOOST_AUTO_TEST_CASE(list_mods_test)
+BOOST_AUTO_TEST_CASE_TEMPLATE(list_mods_test, IntList, IntLists)
 {
-  demehin::List< int > list(3ull, 5);
-  demehin::List< int > list2(3ull, 4);
+  IntList list(3ull, 5);
+  IntList list2(3ull, 4);
   list.push_front(4);
   list.push_back(4);
   std::ostringstream out;
@@ -115,7 +120,7 @@ BOOST_AUTO_TEST_CASE(list_mods_test)
   printList(out7, list2);
   BOOST_TEST(out7.str() == "4445555");
 
-  demehin::List< int > list3;
+  IntList list3;
   for (int i = 0; i < 4; i++)
   {
     list3.push_back(i);
@@ -126,24 +131,24 @@ BOOST_AUTO_TEST_CASE(list_mods_test)
   BOOST_TEST(out8.str() == "3210");
 }
 
-BOOST_AUTO_TEST_CASE(list_operations_test)
+BOOST_AUTO_TEST_CASE_TEMPLATE(list_operations_test, IntList, IntLists)
 {
-  demehin::List< int > lst1(3ull, 5);
-  demehin::List< int > lst2(3ull, 4);
+  IntList lst1(3ull, 5);
+  IntList lst2(3ull, 4);
   lst2.splice(++lst2.cbegin(), lst1);
   std::ostringstream out;
   printList(out, lst2);
   BOOST_TEST(out.str() == "455544");
   BOOST_TEST(lst1.empty());
 
-  demehin::List< int > lst3(1ull, 3);
+  IntList lst3(1ull, 3);
   lst3.push_back(2);
   lst2.splice(lst2.cbegin(), lst3, ++lst3.cbegin());
   std::ostringstream out1;
   printList(out1, lst2);
   BOOST_TEST(out1.str() == "2455544");
 
-  demehin::List< int > lst4(3ull, 1);
+  IntList lst4(3ull, 1);
   lst4.push_front(2);
   lst2.splice(++lst2.cbegin(), lst4, lst4.cbegin(), ++(++lst4.cbegin()));
   std::ostringstream out2;
@@ -162,10 +167,10 @@ BOOST_AUTO_TEST_CASE(list_operations_test)
 
 }
 
-BOOST_AUTO_TEST_CASE(list_operators_test)
+BOOST_AUTO_TEST_CASE_TEMPLATE(list_operators_test, IntList, IntLists)
 {
-  demehin::List< int > lst1(3ull, 5);
-  demehin::List< int > lst2(3ull, 5);
+  IntList lst1(3ull, 5);
+  IntList lst2(3ull, 5);
   BOOST_TEST(lst1 == lst2);
 
   lst1.push_front(1);
@@ -175,7 +180,7 @@ BOOST_AUTO_TEST_CASE(list_operators_test)
   lst1.pop_front();
   lst2.push_back(6);
   BOOST_TEST(lst1 <= lst2);
-  demehin::List< int > lst3(lst2);
+  IntList lst3(lst2);
   BOOST_TEST(lst3 <= lst2);
 
   lst1.push_front(10);
@@ -185,15 +190,15 @@ BOOST_AUTO_TEST_CASE(list_operators_test)
   BOOST_TEST(lst1 >= lst3);
 }
 
-BOOST_AUTO_TEST_CASE(list_test)
+BOOST_AUTO_TEST_CASE_TEMPLATE(list_test, IntList, IntLists)
 {
-  demehin::List< int > list1(5ull, 5);
+  IntList list1(5ull, 5);
   BOOST_TEST(*(++list1.begin()) == 5);
   list1.push_front(6);
   BOOST_TEST(list1.front() == 6);
-  demehin::List< int > mlist(std::move(list1));
+  IntList mlist(std::move(list1));
 
-  demehin::List< int > list;
+  IntList list;
   list.push_back(4);
   list.push_back(5);
   list.push_front(5);
@@ -209,3 +214,69 @@ BOOST_AUTO_TEST_CASE(list_test)
   mlist.clear();
   BOOST_TEST(mlist.empty());
 }
+
+BOOST_AUTO_TEST_CASE_TEMPLATE(list_splice_outlives_source_test, IntList, IntLists)
+{
+  IntList dst(2ull, 1);
+  {
+    IntList src(3ull, 7);
+    src.push_back(8);
+    dst.splice(++dst.cbegin(), src, src.cbegin(), --src.cend());
+    BOOST_TEST(src.size() == 1);
+    IntList rest(1ull, 9);
+    dst.splice(dst.cend(), std::move(rest));
+    BOOST_TEST(rest.empty());
+  }
+  std::ostringstream out;
+  printList(out, dst);
+  BOOST_TEST(out.str() == "177719");
+  BOOST_TEST(dst.size() == 6);
+}
+
+BOOST_AUTO_TEST_CASE(list_pool_test)
+{
+  using PooledList = demehin::List< std::string, demehin::PoolAllocator< std::string > >;
+  PooledList lst;
+  for (int i = 0; i < 1000; i++)
+  {
+    lst.push_back(std::to_string(i));
+  }
+  lst.insert(lst.cbegin(), { "a", "b" });
+  lst.insert(lst.cend(), 3, "x");
+  BOOST_TEST(lst.front() == "a");
+  BOOST_TEST(lst.back() == "x");
+  BOOST_TEST(lst.size() == 1005);
+
+  PooledList cpy(lst);
+  BOOST_TEST(cpy == lst);
+  lst.clear();
+  BOOST_TEST(lst.empty());
+  BOOST_TEST(cpy.size() == 1005);
+  BOOST_TEST(cpy.front() == "a");
+}
+
+BOOST_AUTO_TEST_CASE(node_pool_test)
+{
+  using NodeAlloc = demehin::PoolAllocator< demehin::Node< std::string > >;
+  NodeAlloc alloc;
+  NodeAlloc copy(alloc);
+  BOOST_TEST((copy == alloc));
+  BOOST_TEST((NodeAlloc() != alloc));
+  BOOST_TEST((alloc.select_on_container_copy_construction() != alloc));
+
+  std::vector< demehin::Node< std::string >* > nodes;
+  for (int i = 0; i < 1000; i++)
+  {
+    nodes.push_back(alloc.allocate(1));
+  }
+  BOOST_TEST(alloc.pool().live() == 1000);
+  BOOST_TEST(alloc.pool().slabs() > 1);
+  BOOST_TEST(NodeAlloc().pool().live() == 0);
+
+  for (size_t i = 0; i < nodes.size(); i++)
+  {
+    copy.deallocate(nodes[i], 1);
+  }
+  BOOST_TEST(alloc.pool().live() == 0);
+  BOOST_TEST(alloc.pool().slabs() == 1);
+}
@@ -0,0 +1,31 @@
+#include <bench.hpp>
+#include <string>
+#include <dynamic_array.hpp>
+
+namespace
+{
+  struct ArrayTraits: bench::SequenceTraits< demehin::DynamicArray< int > >
+  {
+    static void push(demehin::DynamicArray< int >& arr, int value)
+    {
+      arr.push(value);
+    }
+  };
+
+  void pushStrings(const char* name, const bench::Options& opts)
+  {
+    const std::string value(32, 'x');
+    demehin::DynamicArray< std::string > arr;
+    bench::Probe probe(name, "push_string");
+    for (size_t i = 0; i < opts.n; ++i)
+    {
+      arr.push(value);
+    }
+    probe.stop(opts.n);
+    bench::keep(arr.size());
+  }
+
+  const bench::Registrar array("demehin::DynamicArray",
+    bench::runSequence< demehin::DynamicArray< int >, ArrayTraits >);
+  const bench::Registrar strings("demehin::DynamicArray<string>", pushStrings);
+}
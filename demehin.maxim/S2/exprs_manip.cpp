@@ -1,55 +1,115 @@
 #include "exprs_manip.hpp"
 #include <stdexcept>
-#include <iostream>
-#include <algorithm>
+#include <limits>
 #include <calc_utils.hpp>
 
 namespace
 {
   using long_t = long long int;
+  using demehin::TokenType;
 
-  bool isOperator(const std::string& str)
+  bool getOperatorType(char c, TokenType& type) noexcept
   {
-    return str == "+" || str == "-" || str == "*" || str == "/" || str == "%";
+    if (c == '+')
+    {
+      type = TokenType::PLUS;
+    }
+    else if (c == '-')
+    {
+      type = TokenType::MINUS;
+    }
+    else if (c == '*')
+    {
+      type = TokenType::MULTIPLY;
+    }
+    else if (c == '/')
+    {
+      type = TokenType::DIVIDE;
+    }
+    else if (c == '%')
+    {
+      type = TokenType::MODULO;
+    }
+    else if (c == '(')
+    {
+      type = TokenType::OPEN_BRACKET;
+    }
+    else if (c == ')')
+    {
+      type = TokenType::CLOSE_BRACKET;
+    }
+    else
+    {
+      return false;
+    }
+    return true;
   }
 
-  int getOpPriority(const std::string& op)
+  bool parseNumber(const char* begin, const char* end, long_t& value) noexcept
   {
-    if (op == "+" || op == "-")
+    bool negative = false;
+    if (begin != end && (*begin == '+' || *begin == '-'))
     {
-      return 1;
+      negative = *begin == '-';
+      ++begin;
     }
-    if (op == "*" || op == "/" || op == "%")
+    if (begin == end)
     {
-      return 2;
+      return false;
     }
-    return 0;
+
+    using ulong_t = unsigned long long int;
+    const ulong_t limit = static_cast< ulong_t >(std::numeric_limits< long_t >::max()) + negative;
+    ulong_t res = 0;
+    for (; begin != end; ++begin)
+    {
+      if (*begin < '0' || *begin > '9')
+      {
+        return false;
+      }
+      ulong_t digit = *begin - '0';
+      if (res > (limit - digit) / 10)
+      {
+        return false;
+      }
+      res = res * 10 + digit;
+    }
+    value = negative ? static_cast< long_t >(0 - res) : static_cast< long_t >(res);
+    return true;
   }
 
-  int compareOpPriority(const std::string& op1, const std::string& op2)
+  int getOpPriority(TokenType op) noexcept
   {
-    return getOpPriority(op1) - getOpPriority(op2);
+    if (op == TokenType::PLUS || op == TokenType::MINUS)
+    {
+      return 1;
+    }
+    if (op == TokenType::MULTIPLY || op == TokenType::DIVIDE || op == TokenType::MODULO)
+    {
+      return 2;
+    }
+    return 0;
   }
 
-  long_t performOperation(long_t op1, long_t op2, const std::string& operation)
+  long_t performOperation(long_t op1, long_t op2, TokenType operation)
   {
-    if (operation == "+")
+    if (operation == TokenType::PLUS)
     {
       return demehin::sumChecked(op1, op2);
     }
-    if (operation == "-")
+    if (operation == TokenType::MINUS)
     {
       return demehin::subtractChecked(op1, op2);
     }
-    if (operation == "*")
+    if (operation == TokenType::MULTIPLY)
     {
       return demehin::multipChecked(op1, op2);
     }
-    if (operation == "/")
+    if (operation == TokenType::DIVIDE)
     {
       return demehin::divideChecked(op1, op2);
     }
-    if (operation == "%")
+    if (operation == TokenType::MODULO)
     {
       return demehin::modulateChecked(op1, op2);
     }
@@ -57,112 +117,102 @@ namespace
   }
 }
 
-demehin::ExprQueue demehin::convertQueue(ExprQueue& infExpr)
+demehin::ExprLexer::ExprLexer(const std::string& line) noexcept:
+  pos_(line.data()),
+  end_(line.data() + line.size())
+{}
+
+bool demehin::ExprLexer::next(Token& token)
 {
-  ExprQueue postExpr;
-  Stack< std::string > stack;
-  while (!infExpr.empty())
+  while (pos_ != end_ && *pos_ == ' ')
   {
-    std::string front = infExpr.front();
-    infExpr.pop();
-    try
-    {
-      std::stoll(front);
-      postExpr.push(front);
-    }
-    catch (...)
-    {
-      if (front == "(")
-      {
-        stack.push(front);
-      }
-      else if (front == ")")
-      {
-        while (!stack.empty() && stack.top() != "(")
-        {
-          postExpr.push(stack.top());
-          stack.pop();
-        }
-        if (stack.empty())
-        {
-          throw std::logic_error("wrong brackets");
-        }
-        stack.pop();
-      }
-      else if (isOperator(front))
-      {
-        while (!stack.empty() && compareOpPriority(front, stack.top()) <= 0)
-        {
-          postExpr.push(stack.top());
-          stack.pop();
-        }
-        stack.push(front);
-      }
-      else
-      {
-        throw std::logic_error("invalid argument");
-      }
-    }
+    ++pos_;
   }
-  while (!stack.empty())
+  if (pos_ == end_)
   {
-    if (stack.top() == "(")
-    {
-      throw std::logic_error("wrong brackets");
-    }
-    postExpr.push(stack.top());
-    stack.pop();
+    return false;
   }
-  return postExpr;
-}
 
-void demehin::convertStack(ExprsStack& infStack, ExprsStack& postStack)
-{
-  while (!infStack.empty())
+  const char* begin = pos_;
+  while (pos_ != end_ && *pos_ != ' ')
+  {
+    ++pos_;
+  }
+  if (pos_ - begin == 1 && getOperatorType(*begin, token.type))
+  {
+    return true;
+  }
+  if (!parseNumber(begin, pos_, token.value))
   {
-    postStack.push(convertQueue(infStack.top()));
-    infStack.pop();
+    throw std::logic_error("invalid argument");
   }
+  token.type = TokenType::NUMBER;
+  return true;
 }
 
-long_t demehin::calculateExpr(const ExprQueue& expr)
+long_t demehin::ExprCalculator::calculate(const std::string& line)
 {
-  Stack< long_t > stack;
-  ExprQueue exprCpy(expr);
-  while (!exprCpy.empty())
+  operators_.clear();
+  operands_.clear();
+  ExprLexer lexer(line);
+  Token token{ TokenType::NUMBER, 0 };
+  while (lexer.next(token))
   {
-    std::string token = exprCpy.front();
-    exprCpy.pop();
-
-    try
+    if (token.type == TokenType::NUMBER)
+    {
+      operands_.push(token.value);
+    }
+    else if (token.type == TokenType::OPEN_BRACKET)
     {
-      stack.push(std::stoll(token));
+      operators_.push(token.type);
     }
-    catch (...)
+    else if (token.type == TokenType::CLOSE_BRACKET)
     {
-      if (stack.size() < 2)
+      while (!operators_.empty() && operators_.top() != TokenType::OPEN_BRACKET)
       {
-        throw std::logic_error("not enough operands");
+        applyTop();
       }
-      long_t op1 = stack.top();
-      stack.pop();
-      long_t op2 = stack.top();
-      stack.pop();
-
-      long_t result = performOperation(op2, op1, token);
-      stack.push(result);
+      if (operators_.empty())
+      {
+        throw std::logic_error("wrong brackets");
+      }
+      operators_.pop();
+    }
+    else
+    {
+      while (!operators_.empty() && getOpPriority(token.type) <= getOpPriority(operators_.top()))
+      {
+        applyTop();
+      }
+      operators_.push(token.type);
     }
   }
 
-  return stack.top();
+  while (!operators_.empty())
+  {
+    if (operators_.top() == TokenType::OPEN_BRACKET)
+    {
+      throw std::logic_error("wrong brackets");
+    }
+    applyTop();
+  }
+  if (operands_.empty())
+  {
+    throw std::logic_error("not enough operands");
+  }
+  return operands_.top();
 }
 
-void demehin::getExprsValues(ExprsStack postStack, Stack< long_t >& values)
+void demehin::ExprCalculator::applyTop()
 {
-  while (!postStack.empty())
+  if (operands_.size() < 2)
   {
-    values.push(calculateExpr(postStack.top()));
-    postStack.pop();
+    throw std::logic_error("not enough operands");
   }
+  long_t op2 = operands_.top();
+  operands_.pop();
+  long_t op1 = operands_.top();
+  operands_.pop();
+  operands_.push(performOperation(op1, op2, operators_.top()));
+  operators_.pop();
 }
-
@@ -1,17 +1,50 @@
 #ifndef EXPR_CONVERT_HPP
 #define EXPR_CONVERT_HPP
 #include <string>
-#include <queue.hpp>
 #include <stack.hpp>
 
 namespace demehin
 {
-  using ExprQueue = demehin::Queue< std::string >;
-  using ExprsStack = demehin::Stack< ExprQueue >;
-  void convertStack(ExprsStack& infExprs, ExprsStack& postExprs);
-  ExprQueue convertQueue(ExprQueue& infExpr);
-  long long int calculateExpr(const ExprQueue& expr);
-  void getExprsValues(ExprsStack postStack, Stack< long long int >& values);
+  enum class TokenType
+  {
+    NUMBER,
+    PLUS,
+    MINUS,
+    MULTIPLY,
+    DIVIDE,
+    MODULO,
+    OPEN_BRACKET,
+    CLOSE_BRACKET
+  };
+
+  struct Token
+  {
+    TokenType type;
+    long long int value;
+  };
+
+  class ExprLexer
+  {
+  public:
+    explicit ExprLexer(const std::string& line) noexcept;
+    bool next(Token& token);
+
+  private:
+    const char* pos_;
+    const char* end_;
+  };
+
+  class ExprCalculator
+  {
+  public:
+    long long int calculate(const std::string& line);
+
+  private:
+    Stack< TokenType > operators_;
+    Stack< long long int > operands_;
+
+    void applyTop();
+  };
 }
 
 #endif
@@ -2,15 +2,13 @@
 #include <fstream>
 #include <string>
 #include <stack.hpp>
-#include <queue.hpp>
 #include "exprs_manip.hpp"
 
 namespace
 {
-  using ExprsStack = demehin::Stack< demehin::Queue < std::string > >;
-
-  void inputExprs(std::istream& in, ExprsStack& stack)
+  void calculateExprs(std::istream& in, demehin::Stack< long long int >& values)
   {
+    demehin::ExprCalculator calculator;
     std::string line;
     while (std::getline(in, line))
     {
@@ -18,23 +16,7 @@ namespace
       {
         continue;
       }
-
-      demehin::Queue< std::string > exprQueue;
-      size_t token_begin = 0;
-      size_t token_end = line.find(' ');
-
-      while (token_end != std::string::npos)
-      {
-        exprQueue.push(line.substr(token_begin, token_end - token_begin));
-        token_begin = token_end + 1;
-        token_end = line.find(' ', token_begin);
-      }
-
-      exprQueue.push(line.substr(token_begin));
-      if (!exprQueue.empty())
-      {
-        stack.push(exprQueue);
-      }
+      values.push(calculator.calculate(line));
     }
   }
 
@@ -56,24 +38,18 @@ namespace
 
 int main(int argc, char* argv[])
 {
-  ExprsStack infExprsStack;
   try
   {
+    demehin::Stack< long long int > res;
     if (argc > 1)
     {
       std::ifstream file(argv[1]);
-      inputExprs(file, infExprsStack);
+      calculateExprs(file, res);
     }
     else
     {
-      inputExprs(std::cin, infExprsStack);
+      calculateExprs(std::cin, res);
     }
-
-    ExprsStack postExprsStack;
-    demehin::convertStack(infExprsStack, postExprsStack);
-
-    demehin::Stack< long long int > res;
-    demehin::getExprsValues(postExprsStack, res);
     printValues(std::cout, res);
     std::cout << "\n";
   }
@@ -83,4 +59,3 @@ int main(int argc, char* argv[])
     return 1;
   }
 }
-
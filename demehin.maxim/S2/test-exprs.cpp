@@ -0,0 +1,128 @@
+#include <boost/test/unit_test.hpp>
+#include <cstdlib>
+#include <limits>
+#include <new>
+#include <stdexcept>
+#include <string>
+#include "exprs_manip.hpp"
+
+namespace
+{
+  size_t allocations = 0;
+
+  void* allocate(size_t size)
+  {
+    ++allocations;
+    void* ptr = std::malloc(size == 0 ? 1 : size);
+    if (!ptr)
+    {
+      throw std::bad_alloc();
+    }
+    return ptr;
+  }
+}
+
+void* operator new(size_t size)
+{
+  return allocate(size);
+}
+
+void* operator new[](size_t size)
+{
+  return allocate(size);
+}
+
+void operator delete(void* ptr) noexcept
+{
+  std::free(ptr);
+}
+
+void operator delete[](void* ptr) noexcept
+{
+  std::free(ptr);
+}
+
+void operator delete(void* ptr, size_t) noexcept
+{
+  std::free(ptr);
+}
+
+void operator delete[](void* ptr, size_t) noexcept
+{
+  std::free(ptr);
+}
+
+BOOST_AUTO_TEST_CASE(lexer_test)
+{
+  std::string line = "( -12 + 3 )  * +4 % 5 / 6";
+  demehin::ExprLexer lexer(line);
+  demehin::Token token{ demehin::TokenType::NUMBER, 0 };
+  const demehin::TokenType types[] = {
+    demehin::TokenType::OPEN_BRACKET,
+    demehin::TokenType::NUMBER,
+    demehin::TokenType::PLUS,
+    demehin::TokenType::NUMBER,
+    demehin::TokenType::CLOSE_BRACKET,
+    demehin::TokenType::MULTIPLY,
+    demehin::TokenType::NUMBER,
+    demehin::TokenType::MODULO,
+    demehin::TokenType::NUMBER,
+    demehin::TokenType::DIVIDE,
+    demehin::TokenType::NUMBER
+  };
+  for (demehin::TokenType type: types)
+  {
+    BOOST_TEST(lexer.next(token));
+    BOOST_TEST((token.type == type));
+  }
+  BOOST_TEST(!lexer.next(token));
+
+  demehin::ExprLexer negative("-12");
+  negative.next(token);
+  BOOST_TEST(token.value == -12);
+
+  std::string invalid = "1 + 2x";
+  demehin::ExprLexer bad(invalid);
+  bad.next(token);
+  bad.next(token);
+  BOOST_CHECK_THROW(bad.next(token), std::logic_error);
+}
+
+BOOST_AUTO_TEST_CASE(number_limits_test)
+{
+  demehin::ExprCalculator calc;
+  BOOST_TEST(calc.calculate("9223372036854775807") == std::numeric_limits< long long int >::max());
+  BOOST_TEST(calc.calculate("-9223372036854775808") == std::numeric_limits< long long int >::min());
+  BOOST_CHECK_THROW(calc.calculate("9223372036854775808"), std::logic_error);
+  BOOST_CHECK_THROW(calc.calculate("9223372036854775807 + 1"), std::overflow_error);
+}
+
+BOOST_AUTO_TEST_CASE(calculate_test)
+{
+  demehin::ExprCalculator calc;
+  BOOST_TEST(calc.calculate("1 + 2 * 3") == 7);
+  BOOST_TEST(calc.calculate("( 1 + 2 ) * 3") == 9);
+  BOOST_TEST(calc.calculate("10 - 4 - 3") == 3);
+  BOOST_TEST(calc.calculate("100 / 10 / 5") == 2);
+  BOOST_TEST(calc.calculate("-7 % 3 + ( ( 2 ) )") == 4);
+  BOOST_CHECK_THROW(calc.calculate("( 1 + 2"), std::logic_error);
+  BOOST_CHECK_THROW(calc.calculate("1 + 2 )"), std::logic_error);
+  BOOST_CHECK_THROW(calc.calculate("1 +"), std::logic_error);
+  BOOST_CHECK_THROW(calc.calculate("1 ^ 2"), std::logic_error);
+  BOOST_TEST(calc.calculate("2 * ( 3 + 4 )") == 14);
+}
+
+BOOST_AUTO_TEST_CASE(calculate_allocations_test)
+{
+  demehin::ExprCalculator calc;
+  const std::string line = "( 1 + 2 ) * ( 3 - ( 4 % 5 ) ) / 6 + 7";
+  long long int expected = calc.calculate(line);
+  size_t before = allocations;
+  long long int sum = 0;
+  for (size_t i = 0; i < 1000; ++i)
+  {
+    sum += calc.calculate(line);
+  }
+  BOOST_TEST(allocations == before);
+  BOOST_TEST(sum == expected * 1000);
+}
@@ -1,8 +1,38 @@
 #include <boost/test/unit_test.hpp>
 #include <sstream>
+#include <string>
+#include <dynamic_array.hpp>
 #include <stack.hpp>
 #include <queue.hpp>
 
+namespace
+{
+  struct Fragile
+  {
+    static int copies_left;
+    int value;
+
+    Fragile(int val):
+      value(val)
+    {}
+
+    Fragile(const Fragile& rhs):
+      value(rhs.value)
+    {
+      if (copies_left-- == 0)
+      {
+        throw std::runtime_error("copy failed");
+      }
+    }
+
+    Fragile(Fragile&& rhs):
+      Fragile(static_cast< const Fragile& >(rhs))
+    {}
+  };
+
+  int Fragile::copies_left = 0;
+}
+
 BOOST_AUTO_TEST_CASE(stack_test)
 {
   demehin::Stack< int > orig_stack;
@@ -64,3 +94,42 @@ BOOST_AUTO_TEST_CASE(queue_test)
   BOOST_TEST(mv_queue.front() == 2);
   BOOST_TEST(mv_queue.back() == 4);
 }
+
+BOOST_AUTO_TEST_CASE(queue_interleaved_test)
+{
+  demehin::Queue< std::string > queue;
+  size_t next = 0;
+  for (size_t i = 0; i < 1000; i++)
+  {
+    queue.push(std::to_string(i));
+    if (i % 3 == 0)
+    {
+      BOOST_TEST(queue.front() == std::to_string(next++));
+      queue.pop();
+    }
+  }
+  BOOST_TEST(queue.size() == 1000 - next);
+  for (; !queue.empty(); next++)
+  {
+    BOOST_TEST(queue.front() == std::to_string(next));
+    queue.pop();
+  }
+  BOOST_TEST(next == 1000);
+}
+
+BOOST_AUTO_TEST_CASE(array_growth_guarantee_test)
+{
+  demehin::DynamicArray< Fragile > arr;
+  Fragile::copies_left = 1000;
+  for (int i = 0; i < 100; i++)
+  {
+    arr.push(Fragile(i));
+  }
+  Fragile::copies_left = 50;
+  BOOST_CHECK_THROW(arr.push(Fragile(100)), std::runtime_error);
+  BOOST_TEST(arr.size() == 100);
+  for (int i = 0; i < 100; i++)
+  {
+    BOOST_TEST(arr[i].value == i);
+  }
+}
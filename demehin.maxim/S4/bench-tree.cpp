@@ -0,0 +1,56 @@
+#include <bench.hpp>
+#include <sstream>
+#include <stdexcept>
+#include <streambuf>
+#include <tree/tree.hpp>
+#include "tree_manips.hpp"
+
+namespace
+{
+  using AugmentedTree = demehin::Tree< int, int, std::less< int >, true >;
+
+  struct NullBuffer: std::streambuf
+  {
+    int overflow(int c) override
+    {
+      return c;
+    }
+  };
+
+  size_t printAllocations(const char* name, size_t count)
+  {
+    demehin::MapOfTrees mapOfTrees;
+    demehin::TreeMap& map = mapOfTrees["big"];
+    auto last = map.emplace(std::make_pair(size_t(0), std::string("v"))).first;
+    for (size_t i = 1; i < count; ++i)
+    {
+      last = map.emplace_hint(last, std::make_pair(i, std::string("v")));
+    }
+
+    NullBuffer buffer;
+    std::ostream out(std::addressof(buffer));
+    std::istringstream in("big");
+    bench::Probe probe(name, "print_n" + std::to_string(count));
+    size_t before = bench::allocationCount();
+    demehin::print(out, in, mapOfTrees);
+    size_t allocs = bench::allocationCount() - before;
+    probe.stop(count);
+    return allocs;
+  }
+
+  void runPrint(const char* name, const bench::Options&)
+  {
+    size_t base = printAllocations(name, 1000);
+    for (size_t count = 10000; count <= 1000000; count *= 10)
+    {
+      if (printAllocations(name, count) != base)
+      {
+        throw std::logic_error("print allocations grow with the dataset size");
+      }
+    }
+  }
+
+  const bench::Registrar tree("demehin::Tree", bench::runMap< demehin::Tree< int, int > >);
+  const bench::Registrar augmented("demehin::Tree<augmented>", bench::runMap< AugmentedTree >);
+  const bench::Registrar print("demehin::print", runPrint);
+}
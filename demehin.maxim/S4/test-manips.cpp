@@ -0,0 +1,32 @@
+#include <boost/test/unit_test.hpp>
+#include <sstream>
+#include "tree_manips.hpp"
+
+namespace
+{
+  demehin::MapOfTrees makeDatasets()
+  {
+    demehin::MapOfTrees mapOfTrees;
+    demehin::TreeMap& first = mapOfTrees["first"];
+    first.insert({ 3, "c" });
+    first.insert({ 1, "a" });
+    first.insert({ 2, "b" });
+    mapOfTrees["empty"];
+    return mapOfTrees;
+  }
+}
+
+BOOST_AUTO_TEST_CASE(print_const_datasets_test)
+{
+  const demehin::MapOfTrees mapOfTrees = makeDatasets();
+
+  std::ostringstream out;
+  std::istringstream in("first empty");
+  demehin::print(out, in, mapOfTrees);
+  demehin::print(out, in, mapOfTrees);
+  BOOST_TEST(out.str() == "first 1 a 2 b 3 c\n<EMPTY>\n");
+  BOOST_TEST(mapOfTrees.at("first").size() == 3);
+
+  std::istringstream missing("none");
+  BOOST_CHECK_THROW(demehin::print(out, missing, mapOfTrees), std::out_of_range);
+}
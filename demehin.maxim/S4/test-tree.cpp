@@ -1,6 +1,9 @@
 #include <boost/test/unit_test.hpp>
 #include <sstream>
+#include <limits>
+#include <map>
 #include <tree/tree.hpp>
+#include <tree/set_operations.hpp>
 
 namespace
 {
@@ -11,6 +14,20 @@ namespace
       out << (*it).second;
     }
   }
+
+  struct DirectedLess
+  {
+    bool descending;
+
+    explicit DirectedLess(bool desc = false):
+      descending(desc)
+    {}
+
+    bool operator()(size_t lhs, size_t rhs) const
+    {
+      return descending ? rhs < lhs : lhs < rhs;
+    }
+  };
 }
 
 BOOST_AUTO_TEST_CASE(extra_test)
@@ -236,3 +253,168 @@ BOOST_AUTO_TEST_CASE(operators_test)
   BOOST_TEST(mv_tree.size() == 2);
   BOOST_TEST(out2.str() == "13");
 }
+
+BOOST_AUTO_TEST_CASE(hint_insertion_inner_test)
+{
+  demehin::Tree< size_t, std::string > tree;
+  tree[3] = "3";
+  tree[1] = "1";
+  tree[5] = "5";
+  tree.emplace_hint(tree.find(3), std::make_pair(4, "4"));
+
+  std::ostringstream out;
+  printTreeValues(out, tree);
+  BOOST_TEST(tree.size() == 4);
+  BOOST_TEST(out.str() == "1345");
+}
+
+BOOST_AUTO_TEST_CASE(erase_root_test)
+{
+  demehin::Tree< size_t, std::string > tree;
+  tree[1] = "1";
+  tree[2] = "2";
+  tree.erase(1);
+
+  BOOST_TEST(tree.size() == 1);
+  BOOST_TEST(tree.count(2) == 1);
+  BOOST_TEST((*tree.begin()).second == "2");
+}
+
+BOOST_AUTO_TEST_CASE(set_operations_test)
+{
+  demehin::Tree< size_t, std::string > lhs{ { 1, "a" }, { 2, "b" }, { 4, "d" }, { 6, "f" } };
+  demehin::Tree< size_t, std::string > rhs{ { 2, "B" }, { 3, "C" }, { 6, "F" }, { 7, "G" } };
+
+  std::ostringstream out1;
+  auto united = demehin::set_union(lhs, rhs);
+  printTreeValues(out1, united);
+  BOOST_TEST(united.size() == 6);
+  BOOST_TEST(out1.str() == "abCdfG");
+
+  std::ostringstream out2;
+  auto intersected = demehin::set_intersection(lhs, rhs);
+  printTreeValues(out2, intersected);
+  BOOST_TEST(intersected.size() == 2);
+  BOOST_TEST(out2.str() == "bf");
+
+  std::ostringstream out3;
+  auto difference = demehin::set_difference(lhs, rhs);
+  printTreeValues(out3, difference);
+  BOOST_TEST(difference.size() == 2);
+  BOOST_TEST(out3.str() == "ad");
+
+  demehin::Tree< size_t, std::string > empty;
+  BOOST_TEST(demehin::set_union(empty, rhs).size() == 4);
+  BOOST_TEST(demehin::set_intersection(lhs, empty).empty());
+  BOOST_TEST(demehin::set_difference(empty, lhs).empty());
+}
+
+BOOST_AUTO_TEST_CASE(set_operations_comparator_test)
+{
+  using DescTree = demehin::Tree< size_t, std::string, DirectedLess >;
+  DescTree lhs(DirectedLess(true));
+  DescTree rhs(DirectedLess(true));
+  for (size_t i = 1; i <= 4; ++i)
+  {
+    lhs.insert({ i, std::string(1, 'a' + i - 1) });
+    rhs.insert({ i + 2, std::string(1, 'A' + i + 1) });
+  }
+
+  auto united = demehin::set_union(lhs, rhs);
+  std::string out;
+  for (auto it = united.begin(); it != united.end(); ++it)
+  {
+    out += (*it).second;
+  }
+  BOOST_TEST(united.size() == 6);
+  BOOST_TEST(out == "FEdcba");
+  BOOST_TEST(united.key_comp().descending);
+  united.insert({ 7, "G" });
+  BOOST_TEST((*united.begin()).first == 7);
+
+  auto intersected = demehin::set_intersection(lhs, rhs);
+  BOOST_TEST(intersected.size() == 2);
+  BOOST_TEST((*intersected.begin()).first == 4);
+
+  auto difference = demehin::set_difference(lhs, rhs);
+  BOOST_TEST(difference.size() == 2);
+  BOOST_TEST((*difference.begin()).first == 2);
+}
+
+BOOST_AUTO_TEST_CASE(order_statistics_test)
+{
+  using OrderTree = demehin::Tree< int, std::string, std::less< int >, true >;
+  OrderTree tree;
+  std::map< int, std::string > reference;
+  BOOST_TEST(tree.key_sum() == 0);
+  BOOST_TEST((tree.select(0) == tree.end()));
+
+  for (int i = 0; i < 2000; i++)
+  {
+    int key = (i * 7919) % 4001 - 2000;
+    tree.insert(std::make_pair(key, "v"));
+    reference.insert(std::make_pair(key, "v"));
+  }
+  auto hint = tree.begin();
+  for (int key = 2001; key < 2100; key++)
+  {
+    hint = tree.insert(hint, std::make_pair(key, "h"));
+    reference.insert(std::make_pair(key, "h"));
+  }
+  for (int key = -2000; key < 2100; key += 7)
+  {
+    tree.erase(key);
+    reference.erase(key);
+  }
+
+  long long total = 0;
+  size_t pos = 0;
+  for (auto it = reference.begin(); it != reference.end(); ++it, ++pos)
+  {
+    BOOST_TEST(tree.rank(it->first) == pos);
+    BOOST_TEST(tree.select(pos)->first == it->first);
+    total += it->first;
+  }
+  BOOST_TEST((tree.select(pos) == tree.end()));
+  BOOST_TEST(tree.key_sum() == total);
+
+  const int bounds[][2] = { { -2000, 2100 }, { -50, 50 }, { 0, 0 }, { 1, 1 }, { 300, 10 }, { 2098, 5000 } };
+  for (const auto& bound: bounds)
+  {
+    size_t count = 0;
+    long long sum = 0;
+    for (auto it = reference.begin(); it != reference.end(); ++it)
+    {
+      if (it->first >= bound[0] && it->first <= bound[1])
+      {
+        count++;
+        sum += it->first;
+      }
+    }
+    BOOST_TEST(tree.count_range(bound[0], bound[1]) == count);
+    BOOST_TEST(tree.sum_range(bound[0], bound[1]) == sum);
+  }
+
+  OrderTree copy(tree);
+  BOOST_TEST(copy.key_sum() == total);
+  tree.clear();
+  BOOST_TEST(tree.key_sum() == 0);
+  BOOST_TEST(tree.count_range(-5000, 5000) == 0);
+}
+
+BOOST_AUTO_TEST_CASE(key_sum_overflow_test)
+{
+  const long long big = std::numeric_limits< long long >::max();
+  demehin::Tree< long long, int, std::less< long long >, true > tree;
+  tree.insert({ big, 0 });
+  tree.insert({ big - 1, 0 });
+  tree.insert({ -big, 0 });
+  tree.insert({ 2 - big, 0 });
+  tree.insert({ 5, 0 });
+  BOOST_TEST(tree.key_sum() == 6);
+  BOOST_TEST(tree.sum_range(2 - big, big - 1) == 6);
+  BOOST_TEST(tree.sum_range(-big, -big) == -big);
+  tree.erase(big - 1);
+  BOOST_TEST(tree.key_sum() == 7 - big);
+  BOOST_TEST(tree.count_range(0, big) == 2);
+}
@@ -4,7 +4,7 @@ void demehin::print(std::ostream& out, std::istream& in, const MapOfTrees& mapOf
 {
   std::string datasetName;
   in >> datasetName;
-  TreeMap map = mapOfTrees.at(datasetName);
+  const TreeMap& map = mapOfTrees.at(datasetName);
   if (map.empty())
   {
     out << "<EMPTY>\n";
@@ -23,97 +23,32 @@ void demehin::makeComplement(std::istream& in, MapOfTrees& mapOfTrees)
 {
   std::string newName, name1, name2;
   in >> newName >> name1 >> name2;
-  TreeMap newMap, map1, map2;
-  if (mapOfTrees.at(name1).size() > mapOfTrees.at(name2).size())
+  const TreeMap& lhsMap = mapOfTrees.at(name1);
+  const TreeMap& rhsMap = mapOfTrees.at(name2);
+  TreeMap newMap;
+  if (lhsMap.size() > rhsMap.size())
   {
-    map1 = mapOfTrees.at(name1);
-    map2 = mapOfTrees.at(name2);
+    newMap = set_difference(lhsMap, rhsMap);
   }
   else
   {
-    map1 = mapOfTrees.at(name2);
-    map2 = mapOfTrees.at(name1);
+    newMap = set_difference(rhsMap, lhsMap);
   }
-
-  for (auto&& key: map1)
-  {
-    if (map2.find(key.first) == map2.end())
-    {
-      newMap.insert(key);
-    }
-  }
-
-  if (newName == name1)
-  {
-    mapOfTrees[name1] = newMap;
-    return;
-  }
-  else if (newName == name2)
-  {
-    mapOfTrees[name2] = newMap;
-    return;
-  }
-
-  mapOfTrees[newName] = newMap;
+  mapOfTrees[newName] = std::move(newMap);
 }
 
 void demehin::makeIntersect(std::istream& in, MapOfTrees& mapOfTrees)
 {
   std::string newName, lhsName, rhsName;
   in >> newName >> lhsName >> rhsName;
-  TreeMap newMap, lhsMap, rhsMap;
-  lhsMap = mapOfTrees.at(lhsName);
-  rhsMap = mapOfTrees.at(rhsName);
-  for (auto&& key: lhsMap)
-  {
-    if (rhsMap.find(key.first) != rhsMap.end())
-    {
-      newMap.insert(key);
-    }
-  }
-
-  if (newName == lhsName)
-  {
-    mapOfTrees[lhsName] = newMap;
-    return;
-  }
-  else if (newName == rhsName)
-  {
-    mapOfTrees[rhsName] = newMap;
-    return;
-  }
-  mapOfTrees[newName] = newMap;
+  TreeMap newMap = set_intersection(mapOfTrees.at(lhsName), mapOfTrees.at(rhsName));
+  mapOfTrees[newName] = std::move(newMap);
 }
 
 void demehin::makeUnion(std::istream& in, MapOfTrees& mapOfTrees)
 {
   std::string newName, lhsName, rhsName;
   in >> newName >> lhsName >> rhsName;
-  TreeMap newMap, lhsMap, rhsMap;
-  lhsMap = mapOfTrees.at(lhsName);
-  rhsMap = mapOfTrees.at(rhsName);
-  for (auto&& key: lhsMap)
-  {
-    newMap.insert(key);
-  }
-  for (auto&& key: rhsMap)
-  {
-    if (newMap.find(key.first) == newMap.end())
-    {
-      newMap.insert(key);
-    }
-  }
-
-  if (newName == lhsName)
-  {
-    mapOfTrees[lhsName] = newMap;
-    return;
-  }
-  else if (newName == rhsName)
-  {
-    mapOfTrees[rhsName] = newMap;
-    return;
-  }
-
-  mapOfTrees[newName] = newMap;
+  TreeMap newMap = set_union(mapOfTrees.at(lhsName), mapOfTrees.at(rhsName));
+  mapOfTrees[newName] = std::move(newMap);
 }
@@ -3,6 +3,7 @@
 #include <string>
 #include <iostream>
 #include <tree/tree.hpp>
+#include <tree/set_operations.hpp>
 
 namespace demehin
 {
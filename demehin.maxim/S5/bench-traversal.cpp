@@ -0,0 +1,64 @@
+#include <bench.hpp>
+#include <algorithm>
+#include <string>
+#include <utility>
+#include <vector>
+#include <tree/tree.hpp>
+#include "key_summ.hpp"
+
+namespace
+{
+  using Map = demehin::Tree< int, std::string >;
+
+  void runAppend(const char* name, const bench::Options& opts)
+  {
+    std::vector< std::pair< const int, std::string > > data;
+    data.reserve(opts.n);
+    for (size_t i = 0; i < opts.n; ++i)
+    {
+      int key = static_cast< int >(i);
+      data.emplace_back(i % 2 ? key : -key, "value");
+    }
+
+    demehin::KeySumm res;
+    bench::Probe append(name, "append");
+    for (const auto& pair: data)
+    {
+      res(pair);
+    }
+    append.stop(opts.n);
+    bench::keep(res.str_res.size() + res.val_res);
+  }
+
+  void runTraversals(const char* name, const bench::Options& opts)
+  {
+    const size_t count = std::min< size_t >(opts.n, 1 << 16);
+    Map tree;
+    auto hint = tree.cbegin();
+    const int first = -static_cast< int >(count / 2);
+    for (size_t i = 0; i < count; ++i)
+    {
+      hint = tree.emplace_hint(hint, first + static_cast< int >(i), "value");
+    }
+
+    demehin::KeySumm lnr;
+    bench::Probe ascending(name, "ascending");
+    lnr = tree.traverse_lnr(lnr);
+    ascending.stop(count);
+
+    demehin::KeySumm rnl;
+    bench::Probe descending(name, "descending");
+    rnl = tree.traverse_rnl(rnl);
+    descending.stop(count);
+
+    demehin::KeySumm br;
+    bench::Probe breadth(name, "breadth");
+    br = tree.traverse_breadth(br);
+    breadth.stop(count);
+
+    bench::keep(lnr.str_res.size() + rnl.str_res.size() + br.str_res.size());
+  }
+
+  const bench::Registrar append("demehin::KeySumm", runAppend);
+  const bench::Registrar traversals("demehin::KeySumm<tree>", runTraversals);
+}
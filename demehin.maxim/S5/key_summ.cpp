@@ -1,19 +1,24 @@
 #include "key_summ.hpp"
 #include <limits>
-#include <calc_utils.hpp>
+#include <memory>
+#include <stdexcept>
 
 namespace
 {
-  bool isOverflow(const int a, const int b)
+  bool addOverflow(int a, int b, int& res) noexcept
   {
+#if defined(__GNUC__) || defined(__clang__)
+    return __builtin_add_overflow(a, b, std::addressof(res));
+#else
     int max = std::numeric_limits< int >::max();
     int min = std::numeric_limits< int >::min();
-    if (a > 0 && b > 0)
+    if ((b > 0 && a > max - b) || (b < 0 && a < min - b))
     {
-      return a > max - b;
+      return true;
     }
-
-    return (a < 0 && b < 0) && (a < min + b);
+    res = a + b;
+    return false;
+#endif
   }
 }
 
@@ -24,18 +29,16 @@ demehin::KeySumm::KeySumm() noexcept:
 
 void demehin::KeySumm::operator()(const std::pair< const int, std::string >& data)
 {
-  if (isOverflow(val_res, data.first))
+  int sum = 0;
+  if (addOverflow(val_res, data.first, sum))
   {
     throw std::logic_error("overflow");
   }
+  val_res = sum;
 
-  val_res += data.first;
-  if (str_res.size() == 0)
-  {
-    str_res = data.second;
-  }
-  else
+  if (!str_res.empty())
   {
-    str_res = str_res + " " + data.second;
+    str_res += ' ';
   }
+  str_res += data.second;
 }
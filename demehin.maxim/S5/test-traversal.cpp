@@ -1,7 +1,9 @@
 #include <boost/test/unit_test.hpp>
+#include <algorithm>
 #include <sstream>
 #include <string>
 #include <limits>
+#include <vector>
 #include <tree/tree.hpp>
 #include "key_summ.hpp"
 
@@ -78,3 +80,58 @@ BOOST_AUTO_TEST_CASE(traversal_big_tree_test)
   BOOST_TEST(rnl_res.str_res == "rightright right rightleft root leftright left leftleft");
   BOOST_TEST(br_res.str_res == "root left right leftleft leftright rightleft rightright");
 }
+
+BOOST_AUTO_TEST_CASE(traversal_order_test)
+{
+  demehin::Tree< int, std::string > tree;
+  std::vector< int > keys;
+  auto collect = [&keys](const std::pair< int, std::string >& data)
+  {
+    keys.push_back(data.first);
+  };
+
+  tree.traverse_lnr(collect);
+  tree.traverse_rnl(collect);
+  tree.traverse_breadth(collect);
+  BOOST_TEST(keys.empty());
+
+  for (int i = 0; i < 1000; i++)
+  {
+    tree[(i * 7919) % 1009] = "v";
+  }
+  for (int i = 0; i < 1009; i += 3)
+  {
+    tree.erase(i);
+  }
+
+  std::vector< int > expected;
+  for (auto it = tree.cbegin(); it != tree.cend(); ++it)
+  {
+    expected.push_back(it->first);
+  }
+
+  tree.traverse_lnr(collect);
+  BOOST_TEST(keys == expected);
+
+  keys.clear();
+  tree.const_traverse_rnl(collect);
+  BOOST_TEST(keys == std::vector< int >(expected.rbegin(), expected.rend()));
+
+  keys.clear();
+  tree.traverse_breadth(collect);
+  std::sort(keys.begin(), keys.end());
+  BOOST_TEST(keys == expected);
+}
+
+BOOST_AUTO_TEST_CASE(key_summ_negative_test)
+{
+  demehin::KeySumm res;
+  res(std::make_pair(-1, std::string("a")));
+  res(std::make_pair(-2, std::string("b")));
+  BOOST_TEST(res.val_res == -3);
+  BOOST_TEST(res.str_res == "a b");
+
+  BOOST_CHECK_THROW(res(std::make_pair(std::numeric_limits< int >::min(), std::string("c"))), std::logic_error);
+  BOOST_TEST(res.val_res == -3);
+  BOOST_TEST(res.str_res == "a b");
+}
@@ -0,0 +1,13 @@
+#include <bench.hpp>
+#include "hash_table.hpp"
+
+namespace
+{
+  using Table = demehin::HashTable< int, int >;
+  using RobinHoodTable = demehin::HashTable< int, int, std::hash< int >, std::equal_to< int >, true >;
+
+  const bench::Registrar table("demehin::HashTable", bench::runMap< Table >);
+  const bench::Registrar robinHood("demehin::HashTable<robin_hood>", bench::runMap< RobinHoodTable >);
+  const bench::Registrar tableChurn("demehin::HashTable", bench::runChurn< Table >);
+  const bench::Registrar robinHoodChurn("demehin::HashTable<robin_hood>", bench::runChurn< RobinHoodTable >);
+}
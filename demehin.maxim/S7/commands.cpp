@@ -4,7 +4,7 @@ namespace
 {
   using demehin::Tree;
 
-  void printBounds(std::ostream& out, const Tree< std::string, Tree< unsigned int, size_t > > bounds)
+  void printBounds(std::ostream& out, const Tree< std::string, Tree< unsigned int, size_t > >& bounds)
   {
     if (bounds.size() == 0)
     {
@@ -26,17 +26,6 @@ namespace
       out << "\n";
     }
   }
-
-  void addEdges(demehin::Graph& gr, const demehin::Graph::Edges& edges)
-  {
-    for (auto it = edges.cbegin(); it != edges.cend(); it++)
-    {
-      for (auto&& weight: it->second)
-      {
-        gr.addEdge(it->first.first, it->first.second, weight);
-      }
-    }
-  }
 }
 
 void demehin::printGraphsNames(std::ostream& out, const MapOfGraphs& graphs)
@@ -57,15 +46,15 @@ void demehin::printVertexesNames(std::ostream& out, std::istream& in, const MapO
 {
   std::string gr_name;
   in >> gr_name;
-  Graph gr = graphs.at(gr_name);
+  const Graph& gr = graphs.at(gr_name);
 
-  if (gr.getVrts().empty())
+  const Graph::Vertexes& vrts = gr.getVrts();
+  if (vrts.empty())
   {
     out << "\n";
     return;
   }
 
-  demehin::Tree< std::string, std::string > vrts = gr.getVrts();
   for (auto it = vrts.begin(); it != vrts.end(); it++)
   {
     out << (*it).first << "\n";
@@ -77,7 +66,7 @@ void demehin::printOutbounds(std::ostream& out, std::istream& in, const MapOfGra
   std::string gr_name, vrt_name;
   in >> gr_name >> vrt_name;
 
-  Graph gr = graphs.at(gr_name);
+  const Graph& gr = graphs.at(gr_name);
 
   if (!gr.hasVrt(vrt_name))
   {
@@ -93,7 +82,7 @@ void demehin::printInbounds(std::ostream& out, std::istream& in, const MapOfGrap
   std::string gr_name, vrt_name;
   in >> gr_name >> vrt_name;
 
-  Graph gr = graphs.at(gr_name);
+  const Graph& gr = graphs.at(gr_name);
 
   if (!gr.hasVrt(vrt_name))
   {
@@ -104,6 +93,27 @@ void demehin::printInbounds(std::ostream& out, std::istream& in, const MapOfGrap
   printBounds(out, inbounds);
 }
 
+void demehin::printStats(std::ostream& out, std::istream& in, const MapOfGraphs& graphs)
+{
+  std::string gr_name;
+  in >> gr_name;
+
+  const Graph::Edges& edges = graphs.at(gr_name).getEdges();
+  HashTableStats st = edges.stats();
+  out << "size " << st.size << " capacity " << st.capacity;
+  out << " load " << static_cast< double >(st.size) / st.capacity;
+  out << " max_load " << edges.max_load_factor() << "\n";
+  out << "probe avg " << st.avg_probe << " max " << st.max_probe << "\n";
+  out << "tombstones " << st.tombstones << " ratio " << static_cast< double >(st.tombstones) / st.capacity << "\n";
+  out << "rehashes " << st.rehashes << "\n";
+  out << "occupancy";
+  for (size_t i = 0; i < st.occupancy.size(); i++)
+  {
+    out << " " << st.occupancy[i];
+  }
+  out << "\n";
+}
+
 void demehin::bind(std::istream& in, MapOfGraphs& graphs)
 {
   std::string gr_name, from, to;
@@ -161,7 +171,7 @@ void demehin::create(std::istream& in, MapOfGraphs& graphs)
     }
     newGraph.addVertex(vrt);
   }
-  graphs[gr_name] = newGraph;
+  graphs[gr_name] = std::move(newGraph);
 
 }
 
@@ -177,15 +187,10 @@ void demehin::merge(std::istream& in, MapOfGraphs& graphs)
 
   Graph res;
 
-  auto g1 = graphs[gr1_name];
-  auto edges1 = g1.getEdges();
-  addEdges(res, edges1);
-
-  auto g2 = graphs[gr2_name];
-  auto edges2 = g2.getEdges();
-  addEdges(res, edges2);
+  res.addEdges(graphs.at(gr1_name));
+  res.addEdges(graphs.at(gr2_name));
 
-  graphs[new_gr_name] = res;
+  graphs[new_gr_name] = std::move(res);
 }
 
 void demehin::extract(std::istream& in, MapOfGraphs& graphs)
@@ -198,25 +203,26 @@ void demehin::extract(std::istream& in, MapOfGraphs& graphs)
     throw std::logic_error("incorrect parameters");
   }
 
-  List< std::string > vrts;
-  auto gr = graphs.at(gr_name);
+  List< Graph::VertexId > vrts;
+  const Graph& gr = graphs.at(gr_name);
   for (size_t i = 0; i < vrt_cnt; i++)
   {
     std::string vrt;
     in >> vrt;
-    if (!gr.hasVrt(vrt))
+    Graph::VertexId id = 0;
+    if (!gr.findId(vrt, id))
     {
       throw std::logic_error("incorrect parameters");
     }
-    vrts.push_back(vrt);
+    vrts.push_back(id);
   }
 
   Graph new_gr;
 
   for (auto it = gr.getEdges().cbegin(); it != gr.getEdges().cend(); it++)
   {
-    std::string from = it->first.first;
-    std::string to = it->first.second;
+    Graph::VertexId from = it->first.first;
+    Graph::VertexId to = it->first.second;
     bool from_found = false;
     bool to_found = false;
     for (auto&& v: vrts)
@@ -235,9 +241,9 @@ void demehin::extract(std::istream& in, MapOfGraphs& graphs)
     {
       for (auto&& w: it->second)
       {
-        new_gr.addEdge(from, to, w);
+        new_gr.addEdge(gr.getName(from), gr.getName(to), w);
       }
     }
   }
-  graphs[new_gr_name] = new_gr;
+  graphs[new_gr_name] = std::move(new_gr);
 }
@@ -12,6 +12,7 @@ namespace demehin
   void printVertexesNames(std::ostream&, std::istream&, const MapOfGraphs&);
   void printOutbounds(std::ostream&, std::istream&, const MapOfGraphs&);
   void printInbounds(std::ostream&, std::istream&, const MapOfGraphs&);
+  void printStats(std::ostream&, std::istream&, const MapOfGraphs&);
   void bind(std::istream&, MapOfGraphs&);
   void cut(std::istream&, MapOfGraphs&);
   void create(std::istream&, MapOfGraphs&);
@@ -1,6 +1,20 @@
 #include "graph.hpp"
+#include <limits>
 
-void demehin::Graph::addVertex(const std::string& vrt) noexcept
+namespace
+{
+  void unlinkNeighbour(demehin::Graph::Neighbours& neighbours, demehin::Graph::VertexId vrt, size_t cnt)
+  {
+    auto it = neighbours.find(vrt);
+    it->second -= cnt;
+    if (it->second == 0)
+    {
+      neighbours.erase(it);
+    }
+  }
+}
+
+void demehin::Graph::addVertex(const std::string& vrt)
 {
   if (!hasVrt(vrt))
   {
@@ -8,66 +22,186 @@ void demehin::Graph::addVertex(const std::string& vrt) noexcept
   }
 }
 
-void demehin::Graph::addEdge(const std::string& from, const std::string& to, unsigned int weight)
+demehin::Graph::VertexId demehin::Graph::addName(const std::string& vrt)
 {
-  auto key = std::make_pair(from, to);
-  edges[key].push_back(weight);
+  size_t cnt = names_.size();
+  VertexId id = names_.intern(vrt);
+  if (names_.size() != cnt)
+  {
+    invalidate();
+    vertexes_.insert(std::make_pair(vrt, id));
+    outbounds_.push(Neighbours());
+    inbounds_.push(Neighbours());
+  }
+  return id;
 }
 
-demehin::Tree< std::string, std::string > demehin::Graph::getVrts() const
+void demehin::Graph::invalidate()
 {
-  Tree< std::string, std::string > vrts;
-  for (auto it = edges.cbegin(); it != edges.cend(); it++)
+  if (frozen_)
   {
-    vrts[it->first.first];
-    vrts[it->first.second];
+    snapshot_ = GraphSnapshot();
+    frozen_ = false;
   }
-  return vrts;
 }
 
-bool demehin::Graph::hasVrt(const std::string& vrt) const
+void demehin::Graph::linkEdge(VertexId from, VertexId to, unsigned int weight)
 {
-  for (auto it = edges.cbegin(); it != edges.cend(); it++)
+  invalidate();
+  edges[std::make_pair(from, to)].push_back(weight);
+  outbounds_[from][to]++;
+  inbounds_[to][from]++;
+}
+
+void demehin::Graph::addEdge(const std::string& from, const std::string& to, unsigned int weight)
+{
+  VertexId fromId = addName(from);
+  VertexId toId = addName(to);
+  linkEdge(fromId, toId, weight);
+}
+
+void demehin::Graph::addEdges(const Graph& other)
+{
+  constexpr VertexId unmapped = std::numeric_limits< VertexId >::max();
+  DynamicArray< VertexId > ids(other.names_.size());
+  for (size_t i = 0; i < ids.size(); i++)
   {
-    if (it->first.first == vrt || it->first.second == vrt)
+    ids[i] = unmapped;
+  }
+
+  for (auto it = other.edges.cbegin(); it != other.edges.cend(); it++)
+  {
+    VertexId from = it->first.first;
+    VertexId to = it->first.second;
+    if (ids[from] == unmapped)
+    {
+      ids[from] = addName(other.names_.name(from));
+    }
+    if (ids[to] == unmapped)
+    {
+      ids[to] = addName(other.names_.name(to));
+    }
+    for (auto&& weight: it->second)
     {
-      return true;
+      linkEdge(ids[from], ids[to], weight);
     }
   }
-  return false;
 }
 
-demehin::Tree< std::string, demehin::Tree< unsigned int, size_t > > demehin::Graph::getOutbounds(const std::string& vrt) const
+const demehin::Graph::Vertexes& demehin::Graph::getVrts() const
 {
-  Tree< std::string, Tree< unsigned int, size_t > > res;
+  return vertexes_;
+}
+
+const demehin::GraphSnapshot& demehin::Graph::freeze() const
+{
+  if (frozen_)
+  {
+    return snapshot_;
+  }
 
+  size_t vrtCnt = names_.size();
+  GraphSnapshot res;
+  res.outOffsets = DynamicArray< size_t >(vrtCnt + 1);
+  res.inOffsets = DynamicArray< size_t >(vrtCnt + 1);
   for (auto it = edges.cbegin(); it != edges.cend(); it++)
   {
-    if (it->first.first == vrt)
+    res.outOffsets[it->first.first + 1] += it->second.size();
+    res.inOffsets[it->first.second + 1] += it->second.size();
+  }
+  for (size_t i = 0; i < vrtCnt; i++)
+  {
+    res.outOffsets[i + 1] += res.outOffsets[i];
+    res.inOffsets[i + 1] += res.inOffsets[i];
+  }
+
+  size_t edgeCnt = res.outOffsets[vrtCnt];
+  res.outTargets = DynamicArray< VertexId >(edgeCnt);
+  res.outWeights = DynamicArray< unsigned int >(edgeCnt);
+  res.inSources = DynamicArray< VertexId >(edgeCnt);
+  res.inWeights = DynamicArray< unsigned int >(edgeCnt);
+  DynamicArray< size_t > outPos(res.outOffsets);
+  DynamicArray< size_t > inPos(res.inOffsets);
+  for (auto it = edges.cbegin(); it != edges.cend(); it++)
+  {
+    VertexId from = it->first.first;
+    VertexId to = it->first.second;
+    for (auto&& weight: it->second)
     {
-      std::string target = it->first.second;
-      for (auto&& weight: it->second)
-      {
-        res[target][weight]++;
-      }
+      res.outTargets[outPos[from]] = to;
+      res.outWeights[outPos[from]++] = weight;
+      res.inSources[inPos[to]] = from;
+      res.inWeights[inPos[to]++] = weight;
     }
   }
-  return res;
+
+  snapshot_ = std::move(res);
+  frozen_ = true;
+  return snapshot_;
+}
+
+bool demehin::Graph::isFrozen() const noexcept
+{
+  return frozen_;
+}
+
+const std::string& demehin::Graph::getName(VertexId id) const noexcept
+{
+  return names_.name(id);
+}
+
+bool demehin::Graph::findId(const std::string& vrt, VertexId& id) const
+{
+  return names_.find(vrt, id);
+}
+
+bool demehin::Graph::hasVrt(const std::string& vrt) const
+{
+  VertexId id = 0;
+  return names_.find(vrt, id);
+}
+
+demehin::Tree< std::string, demehin::Tree< unsigned int, size_t > > demehin::Graph::getOutbounds(const std::string& vrt) const
+{
+  return collectBounds(vrt, true);
 }
 
 demehin::Tree< std::string, demehin::Tree< unsigned int, size_t > > demehin::Graph::getInbounds(const std::string& vrt) const
+{
+  return collectBounds(vrt, false);
+}
+
+demehin::Tree< std::string, demehin::Tree< unsigned int, size_t > > demehin::Graph::collectBounds(
+  const std::string& vrt, bool isOutbound) const
 {
   Tree< std::string, Tree< unsigned int, size_t > > res;
+  VertexId id = 0;
+  if (!names_.find(vrt, id))
+  {
+    return res;
+  }
 
-  for (auto it = edges.cbegin(); it != edges.cend(); it++)
+  if (frozen_)
+  {
+    const DynamicArray< size_t >& offsets = isOutbound ? snapshot_.outOffsets : snapshot_.inOffsets;
+    const DynamicArray< VertexId >& ends = isOutbound ? snapshot_.outTargets : snapshot_.inSources;
+    const DynamicArray< unsigned int >& weights = isOutbound ? snapshot_.outWeights : snapshot_.inWeights;
+    for (size_t i = offsets[id]; i < offsets[id + 1]; i++)
+    {
+      res[names_.name(ends[i])][weights[i]]++;
+    }
+    return res;
+  }
+
+  const DynamicArray< Neighbours >& index = isOutbound ? outbounds_ : inbounds_;
+  for (auto it = index[id].cbegin(); it != index[id].cend(); it++)
   {
-    if (it->first.second == vrt)
+    VertexId target = it->first;
+    auto key = isOutbound ? std::make_pair(id, target) : std::make_pair(target, id);
+    Tree< unsigned int, size_t >& weights = res[names_.name(target)];
+    for (auto&& weight: edges.at(key))
     {
-      std::string target = it->first.first;
-      for (auto&& weight: it->second)
-      {
-        res[target][weight]++;
-      }
+      weights[weight]++;
     }
   }
   return res;
@@ -75,22 +209,27 @@ demehin::Tree< std::string, demehin::Tree< unsigned int, size_t > > demehin::Gra
 
 bool demehin::Graph::deleteEdge(const std::string& from, const std::string& to, unsigned int weight)
 {
-  auto key = std::make_pair(from, to);
-  auto edgeIt = edges.find(key);
+  VertexId fromId = 0;
+  VertexId toId = 0;
+  if (!names_.find(from, fromId) || !names_.find(to, toId))
+  {
+    return false;
+  }
 
+  auto edgeIt = edges.find(std::make_pair(fromId, toId));
   if (edgeIt == edges.end())
   {
     return false;
   }
 
   auto& weights = edgeIt->second;
-  bool isDeleted = false;
+  size_t deleted = 0;
   for (auto it = weights.cbegin(); it != weights.cend();)
   {
     if (*it == weight)
     {
       it = weights.erase(it);
-      isDeleted = true;
+      deleted++;
     }
     else
     {
@@ -98,7 +237,13 @@ bool demehin::Graph::deleteEdge(const std::string& from, const std::string& to,
     }
   }
 
-  return isDeleted;
+  if (deleted != 0)
+  {
+    invalidate();
+    unlinkNeighbour(outbounds_[fromId], toId, deleted);
+    unlinkNeighbour(inbounds_[toId], fromId, deleted);
+  }
+  return deleted != 0;
 }
 
 const demehin::Graph::Edges& demehin::Graph::getEdges() const
@@ -1,37 +1,75 @@
 #ifndef GRAPH_HPP
 #define GRAPH_HPP
 #include <string>
+#include <type_traits>
+#include <dynamic_array.hpp>
 #include <list/list.hpp>
 #include <tree/tree.hpp>
 #include "hash_table.hpp"
+#include "vertex_names.hpp"
 
 namespace demehin
 {
-  struct PairHash
+  inline size_t hashCombine(size_t seed, size_t value) noexcept
   {
-    size_t operator()(const std::pair< std::string, std::string >& p) const
+    return seed ^ (value + static_cast< size_t >(0x9E3779B97F4A7C15ull) + (seed << 6) + (seed >> 2));
+  }
+
+  struct IdPairHash
+  {
+    size_t operator()(const std::pair< VertexNames::Id, VertexNames::Id >& p) const noexcept
     {
-      return std::hash< std::string >()(p.first) ^ std::hash< std::string >()(p.second);
+      return hashCombine(hashCombine(0, p.first), p.second);
     }
   };
 
+  struct GraphSnapshot
+  {
+    DynamicArray< size_t > outOffsets;
+    DynamicArray< VertexNames::Id > outTargets;
+    DynamicArray< unsigned int > outWeights;
+    DynamicArray< size_t > inOffsets;
+    DynamicArray< VertexNames::Id > inSources;
+    DynamicArray< unsigned int > inWeights;
+  };
+
   class Graph
   {
   public:
-    using PairOfStr = std::pair< std::string, std::string >;
-    using Edges = HashTable< PairOfStr, List< unsigned int >, PairHash >;
+    using VertexId = VertexNames::Id;
+    using PairOfIds = std::pair< VertexId, VertexId >;
+    using Edges = HashTable< PairOfIds, List< unsigned int >, IdPairHash >;
+    using Neighbours = Tree< VertexId, size_t >;
+    static_assert(std::is_nothrow_move_constructible< Neighbours >::value, "");
+    using Vertexes = Tree< std::string, VertexId >;
 
-    void addVertex(const std::string&) noexcept;
+    void addVertex(const std::string&);
     void addEdge(const std::string&, const std::string&, unsigned int);
+    void addEdges(const Graph&);
     bool deleteEdge(const std::string&, const std::string&, unsigned int);
     const Edges& getEdges() const;
-    Tree< std::string, std::string > getVrts() const;
+    const Vertexes& getVrts() const;
+    const GraphSnapshot& freeze() const;
+    bool isFrozen() const noexcept;
+    const std::string& getName(VertexId) const noexcept;
+    bool findId(const std::string&, VertexId&) const;
     Tree< std::string, Tree< unsigned int, size_t > > getOutbounds(const std::string&) const;
     Tree< std::string, Tree< unsigned int, size_t > > getInbounds(const std::string&) const;
     bool hasVrt(const std::string&) const;
 
   private:
+    VertexNames names_;
+    Vertexes vertexes_;
     Edges edges;
+    DynamicArray< Neighbours > outbounds_;
+    DynamicArray< Neighbours > inbounds_;
+    mutable GraphSnapshot snapshot_;
+    mutable bool frozen_ = false;
+
+    VertexId addName(const std::string&);
+    void invalidate();
+    void linkEdge(VertexId, VertexId, unsigned int);
+    Tree< std::string, Tree< unsigned int, size_t > > collectBounds(const std::string&, bool) const;
   };
 }
 
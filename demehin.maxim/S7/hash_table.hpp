@@ -1,19 +1,33 @@
 #ifndef HASH_TABLE_HPP
 #define HASH_TABLE_HPP
+#include <algorithm>
 #include <functional>
+#include <utility>
 #include <dynamic_array.hpp>
 #include "hash_table_iterator.hpp"
 
 namespace demehin
 {
-  template < typename Key, typename T, typename Hash = std::hash< Key >, typename Equal = std::equal_to< Key > >
+  struct HashTableStats
+  {
+    size_t size;
+    size_t capacity;
+    size_t tombstones;
+    size_t rehashes;
+    size_t max_probe;
+    double avg_probe;
+    DynamicArray< size_t > occupancy;
+  };
+
+  template < typename Key, typename T, typename Hash = std::hash< Key >, typename Equal = std::equal_to< Key >,
+    bool RobinHood = false >
   class HashTable
   {
-    friend class HashTIterator< Key, T, Hash, Equal, false >;
-    friend class HashTIterator< Key, T, Hash, Equal, true >;
+    friend class HashTIterator< Key, T, Hash, Equal, RobinHood, false >;
+    friend class HashTIterator< Key, T, Hash, Equal, RobinHood, true >;
   public:
-    using Iter = HashTIterator< Key, T, Hash, Equal, false >;
-    using cIter = HashTIterator< Key, T, Hash, Equal, true >;
+    using Iter = HashTIterator< Key, T, Hash, Equal, RobinHood, false >;
+    using cIter = HashTIterator< Key, T, Hash, Equal, RobinHood, true >;
 
     HashTable();
 
@@ -55,6 +69,7 @@ namespace demehin
     float load_factor() const noexcept;
     float max_load_factor() const noexcept;
     void max_load_factor(float);
+    HashTableStats stats() const;
 
     Iter begin() noexcept;
     Iter end() noexcept;
@@ -76,6 +91,7 @@ namespace demehin
     {
       std::pair< Key, T > pair;
       SlotState state = SlotState::EMPTY;
+      size_t dist = 0;
     };
 
     DynamicArray< Slot > slots_;
@@ -83,22 +99,26 @@ namespace demehin
     Hash hasher_;
     Equal equal_;
     float max_load_factor_ = 0.7;
+    size_t rehash_cnt_ = 0;
 
     size_t findKey(const Key&) const;
     size_t findSlot(const Key&) const;
     size_t findSlotIn(const Key&, const DynamicArray< Slot >&) const noexcept;
+    size_t placeRobinHood(std::pair< Key, T >&&, DynamicArray< Slot >&) const;
+    size_t homeIndex(const Key&, size_t) const;
+    size_t probeLength(size_t) const;
 
   };
 
-  template< typename Key, typename T, typename Hash, typename Equal >
-  HashTable< Key, T, Hash, Equal >::HashTable():
+  template< typename Key, typename T, typename Hash, typename Equal, bool RobinHood >
+  HashTable< Key, T, Hash, Equal, RobinHood >::HashTable():
     slots_(16),
     item_cnt_(0)
   {}
 
-  template< typename Key, typename T, typename Hash, typename Equal >
+  template< typename Key, typename T, typename Hash, typename Equal, bool RobinHood >
   template< typename InputIt >
-  HashTable< Key, T, Hash, Equal >::HashTable(InputIt first, InputIt last):
+  HashTable< Key, T, Hash, Equal, RobinHood >::HashTable(InputIt first, InputIt last):
     HashTable()
   {
     for (auto it = first; it != last; it++)
@@ -107,8 +127,8 @@ namespace demehin
     }
   }
 
-  template< typename Key, typename T, typename Hash, typename Equal >
-  HashTable< Key, T, Hash, Equal >::HashTable(std::initializer_list< std::pair< Key, T > > ilist):
+  template< typename Key, typename T, typename Hash, typename Equal, bool RobinHood >
+  HashTable< Key, T, Hash, Equal, RobinHood >::HashTable(std::initializer_list< std::pair< Key, T > > ilist):
     HashTable()
   {
     for (auto it = ilist.begin(); it != ilist.end(); it++)
@@ -117,20 +137,45 @@ namespace demehin
     }
   }
 
-  template< typename Key, typename T, typename Hash, typename Equal >
-  size_t HashTable< Key, T, Hash, Equal >::findKey(const Key& key) const
+  template< typename Key, typename T, typename Hash, typename Equal, bool RobinHood >
+  size_t HashTable< Key, T, Hash, Equal, RobinHood >::homeIndex(const Key& key, size_t size) const
   {
-    size_t hash_val = hasher_(key) % slots_.size();
+    size_t hash_val = hasher_(key);
+    if (RobinHood)
+    {
+      hash_val *= static_cast< size_t >(0x9E3779B97F4A7C15ull);
+      hash_val ^= hash_val >> (sizeof(size_t) * 4);
+    }
+    return hash_val % size;
+  }
+
+  template< typename Key, typename T, typename Hash, typename Equal, bool RobinHood >
+  size_t HashTable< Key, T, Hash, Equal, RobinHood >::findKey(const Key& key) const
+  {
+    size_t hash_val = homeIndex(key, slots_.size());
     size_t ind = hash_val;
     size_t i = 1;
 
+    if (RobinHood)
+    {
+      for (size_t dist = 0; slots_[ind].state == SlotState::OCCUPIED && slots_[ind].dist >= dist; dist++)
+      {
+        if (equal_(slots_[ind].pair.first, key))
+        {
+          return ind;
+        }
+        ind = (ind + 1) % slots_.size();
+      }
+      return slots_.size();
+    }
+
     while (slots_[ind].state != SlotState::EMPTY)
     {
       if (slots_[ind].state == SlotState::OCCUPIED && equal_(slots_[ind].pair.first, key))
       {
         return ind;
       }
-      ind = (hash_val + i * i) % slots_.size();
+      ind = (hash_val + i * (i + 1) / 2) % slots_.size();
       i++;
 
       if (i > slots_.size())
@@ -141,8 +186,8 @@ namespace demehin
     return slots_.size();
   }
 
-  template< typename Key, typename T, typename Hash, typename Equal >
-  size_t HashTable< Key, T, Hash, Equal >::findSlot(const Key& key) const
+  template< typename Key, typename T, typename Hash, typename Equal, bool RobinHood >
+  size_t HashTable< Key, T, Hash, Equal, RobinHood >::findSlot(const Key& key) const
   {
     size_t hash_val = hasher_(key) % slots_.size();
     size_t first_deleted = slots_.size();
@@ -161,7 +206,7 @@ namespace demehin
         first_deleted = ind;
       }
 
-      ind = (hash_val + i * i) % slots_.size();
+      ind = (hash_val + i * (i + 1) / 2) % slots_.size();
       i++;
 
       if (i > slots_.size())
@@ -172,8 +217,8 @@ namespace demehin
     return (first_deleted != slots_.size()) ? first_deleted : ind;
   }
 
-  template< typename Key, typename T, typename Hash, typename Equal >
-  size_t HashTable< Key, T, Hash, Equal >::findSlotIn(const Key& key, const DynamicArray< Slot >& target) const noexcept
+  template< typename Key, typename T, typename Hash, typename Equal, bool RobinHood >
+  size_t HashTable< Key, T, Hash, Equal, RobinHood >::findSlotIn(const Key& key, const DynamicArray< Slot >& target) const noexcept
   {
     size_t hash_val = hasher_(key) % target.size();
     size_t ind = hash_val;
@@ -181,28 +226,66 @@ namespace demehin
 
     while (target[ind].state == SlotState::OCCUPIED)
     {
-      ind = (hash_val + i * i) % target.size();
+      ind = (hash_val + i * (i + 1) / 2) % target.size();
       i++;
     }
     return ind;
   }
 
-  template< typename Key, typename T, typename Hash, typename Equal >
-  void HashTable< Key, T, Hash, Equal >::rehash(size_t new_size)
+  template< typename Key, typename T, typename Hash, typename Equal, bool RobinHood >
+  size_t HashTable< Key, T, Hash, Equal, RobinHood >::placeRobinHood(std::pair< Key, T >&& value, DynamicArray< Slot >& target) const
+  {
+    size_t ind = homeIndex(value.first, target.size());
+    size_t dist = 0;
+    size_t placed = target.size();
+
+    while (target[ind].state == SlotState::OCCUPIED)
+    {
+      if (target[ind].dist < dist)
+      {
+        std::swap(target[ind].pair, value);
+        std::swap(target[ind].dist, dist);
+        if (placed == target.size())
+        {
+          placed = ind;
+        }
+      }
+      ind = (ind + 1) % target.size();
+      dist++;
+    }
+
+    target[ind].pair = std::move(value);
+    target[ind].state = SlotState::OCCUPIED;
+    target[ind].dist = dist;
+    return (placed == target.size()) ? ind : placed;
+  }
+
+  template< typename Key, typename T, typename Hash, typename Equal, bool RobinHood >
+  void HashTable< Key, T, Hash, Equal, RobinHood >::rehash(size_t new_size)
   {
     if (new_size < item_cnt_ / max_load_factor_)
     {
       new_size = static_cast< size_t >(item_cnt_ / max_load_factor_) + 1;
     }
-    if (new_size <= slots_.size())
+    // triangular probing reaches every slot only when the capacity is a power of two
+    size_t capacity = slots_.size();
+    while (capacity < new_size)
+    {
+      capacity *= 2;
+    }
+    if (capacity == slots_.size())
     {
       return;
     }
 
-    DynamicArray< Slot > new_slots(new_size);
+    DynamicArray< Slot > new_slots(capacity);
     for (auto&& slot: slots_)
     {
-      if (slot.state == SlotState::OCCUPIED)
+      if (slot.state == SlotState::OCCUPIED && RobinHood)
+      {
+        placeRobinHood(std::move(slot.pair), new_slots);
+      }
+      else if (slot.state == SlotState::OCCUPIED)
       {
         size_t ind = findSlotIn(slot.pair.first, new_slots);
         new_slots[ind] = slot;
@@ -210,22 +293,23 @@ namespace demehin
       }
     }
     slots_ = std::move(new_slots);
+    rehash_cnt_++;
   }
 
-  template< typename Key, typename T, typename Hash, typename Equal >
-  float HashTable< Key, T, Hash, Equal >::load_factor() const noexcept
+  template< typename Key, typename T, typename Hash, typename Equal, bool RobinHood >
+  float HashTable< Key, T, Hash, Equal, RobinHood >::load_factor() const noexcept
   {
     return static_cast< float >(item_cnt_) / slots_.size();
   }
 
-  template< typename Key, typename T, typename Hash, typename Equal >
-  float HashTable< Key, T, Hash, Equal >::max_load_factor() const noexcept
+  template< typename Key, typename T, typename Hash, typename Equal, bool RobinHood >
+  float HashTable< Key, T, Hash, Equal, RobinHood >::max_load_factor() const noexcept
   {
     return max_load_factor_;
   }
 
-  template< typename Key, typename T, typename Hash, typename Equal >
-  void HashTable< Key, T, Hash, Equal >::max_load_factor(float ml)
+  template< typename Key, typename T, typename Hash, typename Equal, bool RobinHood >
+  void HashTable< Key, T, Hash, Equal, RobinHood >::max_load_factor(float ml)
   {
     max_load_factor_ = ml;
     if (load_factor() > max_load_factor_)
@@ -234,54 +318,35 @@ namespace demehin
     }
   }
 
-  template< typename Key, typename T, typename Hash, typename Equal >
-  size_t HashTable< Key, T, Hash, Equal >::size() const noexcept
+  template< typename Key, typename T, typename Hash, typename Equal, bool RobinHood >
+  size_t HashTable< Key, T, Hash, Equal, RobinHood >::size() const noexcept
   {
     return item_cnt_;
   }
 
-  template< typename Key, typename T, typename Hash, typename Equal >
-  bool HashTable< Key, T, Hash, Equal >::empty() const noexcept
+  template< typename Key, typename T, typename Hash, typename Equal, bool RobinHood >
+  bool HashTable< Key, T, Hash, Equal, RobinHood >::empty() const noexcept
   {
     return item_cnt_ == 0;
   }
 
-  template< typename Key, typename T, typename Hash, typename Equal >
-  std::pair< typename HashTable< Key, T, Hash, Equal >::Iter, bool > HashTable< Key, T, Hash, Equal >::insert(const std::pair< Key, T >& val)
+  template< typename Key, typename T, typename Hash, typename Equal, bool RobinHood >
+  std::pair< typename HashTable< Key, T, Hash, Equal, RobinHood >::Iter, bool > HashTable< Key, T, Hash, Equal, RobinHood >::insert(const std::pair< Key, T >& val)
   {
-    const Key& key = val.first;
-
-    if (load_factor() >= max_load_factor_)
-    {
-      rehash(slots_.size() * 2);
-    }
-
-    size_t ind = findSlot(key);
-    Slot& slot = slots_[ind];
-
-    if (slot.state == SlotState::OCCUPIED)
-    {
-      return { Iter(this, ind), false };
-    }
-
-    slot.pair = val;
-    slot.state = SlotState::OCCUPIED;
-    item_cnt_++;
-
-    return { Iter(this, ind), true };
+    return emplace(val);
   }
 
-  template< typename Key, typename T, typename Hash, typename Equal >
-  typename HashTable< Key, T, Hash, Equal >::Iter HashTable< Key, T, Hash, Equal >::insert(cIter hint, const Key& key)
+  template< typename Key, typename T, typename Hash, typename Equal, bool RobinHood >
+  typename HashTable< Key, T, Hash, Equal, RobinHood >::Iter HashTable< Key, T, Hash, Equal, RobinHood >::insert(cIter hint, const Key& key)
   {
     return emplace_hint(hint, key);
   }
 
-  template< typename Key, typename T, typename Hash, typename Equal >
+  template< typename Key, typename T, typename Hash, typename Equal, bool RobinHood >
   template< typename InputIt >
-  void HashTable< Key, T, Hash, Equal >::insert(InputIt first, InputIt last)
+  void HashTable< Key, T, Hash, Equal, RobinHood >::insert(InputIt first, InputIt last)
   {
-    HashTable< Key, T, Hash, Equal > temp(*this);
+    HashTable< Key, T, Hash, Equal, RobinHood > temp(*this);
     for (auto it = first; it != last; it++)
     {
       temp.insert(*it);
@@ -289,9 +354,9 @@ namespace demehin
     swap(temp);
   }
 
-  template< typename Key, typename T, typename Hash, typename Equal >
+  template< typename Key, typename T, typename Hash, typename Equal, bool RobinHood >
   template< typename... Args >
-  std::pair< typename HashTable< Key, T, Hash, Equal >::Iter, bool > HashTable< Key, T, Hash, Equal >::emplace(Args&&... args)
+  std::pair< typename HashTable< Key, T, Hash, Equal, RobinHood >::Iter, bool > HashTable< Key, T, Hash, Equal, RobinHood >::emplace(Args&&... args)
   {
     std::pair< Key, T > tempPair(std::forward< Args >(args)...);
     const Key& key = tempPair.first;
@@ -301,6 +366,18 @@ namespace demehin
       rehash(slots_.size() * 2);
     }
 
+    if (RobinHood)
+    {
+      size_t index = findKey(key);
+      if (index != slots_.size())
+      {
+        return { Iter(this, index), false };
+      }
+      index = placeRobinHood(std::move(tempPair), slots_);
+      item_cnt_++;
+      return { Iter(this, index), true };
+    }
+
     size_t index = findSlot(key);
     Slot& slot = slots_[index];
 
@@ -309,16 +386,16 @@ namespace demehin
       return { Iter(this, index), false };
     }
 
-    new (&slot.pair) std::pair< Key, T >(std::move(tempPair));
+    slot.pair = std::move(tempPair);
     slot.state = SlotState::OCCUPIED;
     item_cnt_++;
 
     return { Iter(this, index), true };
   }
 
-  template< typename Key, typename T, typename Hash, typename Equal >
+  template< typename Key, typename T, typename Hash, typename Equal, bool RobinHood >
   template< typename... Args >
-  typename HashTable< Key, T, Hash, Equal >::Iter HashTable< Key, T, Hash, Equal >::emplace_hint(cIter hint, Args&&... args)
+  typename HashTable< Key, T, Hash, Equal, RobinHood >::Iter HashTable< Key, T, Hash, Equal, RobinHood >::emplace_hint(cIter hint, Args&&... args)
   {
     std::pair< Key, T > tempPair(std::forward< Args >(args)...);
     const Key& key = tempPair.first;
@@ -337,21 +414,21 @@ namespace demehin
     return emplace(std::move(tempPair)).first;
   }
 
-  template< typename Key, typename T, typename Hash, typename Equal >
-  T& HashTable< Key, T, Hash, Equal >::operator[](const Key& key)
+  template< typename Key, typename T, typename Hash, typename Equal, bool RobinHood >
+  T& HashTable< Key, T, Hash, Equal, RobinHood >::operator[](const Key& key)
   {
     auto res = insert(std::make_pair(key, T()));
     return res.first->second;
   }
 
-  template< typename Key, typename T, typename Hash, typename Equal >
-  const T& HashTable< Key, T, Hash, Equal >::operator[](const Key& key) const
+  template< typename Key, typename T, typename Hash, typename Equal, bool RobinHood >
+  const T& HashTable< Key, T, Hash, Equal, RobinHood >::operator[](const Key& key) const
   {
     return at(key);
   }
 
-  template< typename Key, typename T, typename Hash, typename Equal >
-  T& HashTable< Key, T, Hash, Equal >::at(const Key& key)
+  template< typename Key, typename T, typename Hash, typename Equal, bool RobinHood >
+  T& HashTable< Key, T, Hash, Equal, RobinHood >::at(const Key& key)
   {
     size_t ind = findKey(key);
     if (ind == slots_.size())
@@ -362,10 +439,10 @@ namespace demehin
     return slots_[ind].pair.second;
   }
 
-  template< typename Key, typename T, typename Hash, typename Equal >
-  const T& HashTable< Key, T, Hash, Equal >::at(const Key& key) const
+  template< typename Key, typename T, typename Hash, typename Equal, bool RobinHood >
+  const T& HashTable< Key, T, Hash, Equal, RobinHood >::at(const Key& key) const
   {
-    size_t ind = find_key(key);
+    size_t ind = findKey(key);
     if (ind == slots_.size())
     {
       throw std::logic_error("key not found");
@@ -374,46 +451,46 @@ namespace demehin
     return slots_[ind].pair.second;
   }
 
-  template< typename Key, typename T, typename Hash, typename Equal >
-  typename HashTable< Key, T, Hash, Equal >::Iter HashTable< Key, T, Hash, Equal >::begin() noexcept
+  template< typename Key, typename T, typename Hash, typename Equal, bool RobinHood >
+  typename HashTable< Key, T, Hash, Equal, RobinHood >::Iter HashTable< Key, T, Hash, Equal, RobinHood >::begin() noexcept
   {
     return Iter(this, 0);
   }
 
-  template< typename Key, typename T, typename Hash, typename Equal >
-  typename HashTable< Key, T, Hash, Equal >::Iter HashTable< Key, T, Hash, Equal >::end() noexcept
+  template< typename Key, typename T, typename Hash, typename Equal, bool RobinHood >
+  typename HashTable< Key, T, Hash, Equal, RobinHood >::Iter HashTable< Key, T, Hash, Equal, RobinHood >::end() noexcept
   {
     return Iter(this, slots_.size());
   }
 
-  template< typename Key, typename T, typename Hash, typename Equal >
-  typename HashTable< Key, T, Hash, Equal >::cIter HashTable< Key, T, Hash, Equal >::cbegin() const noexcept
+  template< typename Key, typename T, typename Hash, typename Equal, bool RobinHood >
+  typename HashTable< Key, T, Hash, Equal, RobinHood >::cIter HashTable< Key, T, Hash, Equal, RobinHood >::cbegin() const noexcept
   {
     return cIter(this, 0);
   }
 
-  template< typename Key, typename T, typename Hash, typename Equal >
-  typename HashTable< Key, T, Hash, Equal >::cIter HashTable< Key, T, Hash, Equal >::cend() const noexcept
+  template< typename Key, typename T, typename Hash, typename Equal, bool RobinHood >
+  typename HashTable< Key, T, Hash, Equal, RobinHood >::cIter HashTable< Key, T, Hash, Equal, RobinHood >::cend() const noexcept
   {
     return cIter(this, slots_.size());
   }
 
-  template< typename Key, typename T, typename Hash, typename Equal >
-  typename HashTable< Key, T, Hash, Equal >::Iter HashTable< Key, T, Hash, Equal >::find(const Key& key)
+  template< typename Key, typename T, typename Hash, typename Equal, bool RobinHood >
+  typename HashTable< Key, T, Hash, Equal, RobinHood >::Iter HashTable< Key, T, Hash, Equal, RobinHood >::find(const Key& key)
   {
     size_t ind = findKey(key);
     return (ind == slots_.size()) ? end() : Iter(this, ind);
   }
 
-  template< typename Key, typename T, typename Hash, typename Equal >
-  typename HashTable< Key, T, Hash, Equal >::cIter HashTable< Key, T, Hash, Equal >::find(const Key& key) const
+  template< typename Key, typename T, typename Hash, typename Equal, bool RobinHood >
+  typename HashTable< Key, T, Hash, Equal, RobinHood >::cIter HashTable< Key, T, Hash, Equal, RobinHood >::find(const Key& key) const
   {
     size_t ind = findKey(key);
     return (ind == slots_.size()) ? cend() : cIter(this, ind);
   }
 
-  template< typename Key, typename T, typename Hash, typename Equal >
-  size_t HashTable< Key, T, Hash, Equal >::erase(const Key& key) noexcept
+  template< typename Key, typename T, typename Hash, typename Equal, bool RobinHood >
+  size_t HashTable< Key, T, Hash, Equal, RobinHood >::erase(const Key& key) noexcept
   {
     cIter it = find(key);
     if (it != end())
@@ -424,23 +501,38 @@ namespace demehin
     return 0;
   }
 
-  template< typename Key, typename T, typename Hash, typename Equal >
-  typename HashTable< Key, T, Hash, Equal >::Iter HashTable< Key, T, Hash, Equal >::erase(cIter pos) noexcept
+  template< typename Key, typename T, typename Hash, typename Equal, bool RobinHood >
+  typename HashTable< Key, T, Hash, Equal, RobinHood >::Iter HashTable< Key, T, Hash, Equal, RobinHood >::erase(cIter pos) noexcept
   {
-    slots_[pos.index_].state = SlotState::DELETED;
-    item_cnt_--;
-
-    size_t next_ind = pos.index_ + 1;
-    while (next_ind < slots_.size() && slots_[next_ind].state != SlotState::OCCUPIED)
+    if (RobinHood)
     {
-      next_ind++;
+      size_t ind = pos.index_;
+      size_t limit = pos.limit_;
+      size_t next = (ind + 1) % slots_.size();
+      while (slots_[next].state == SlotState::OCCUPIED && slots_[next].dist > 0)
+      {
+        slots_[ind].pair = std::move(slots_[next].pair);
+        slots_[ind].dist = slots_[next].dist - 1;
+        // an element shifted back across slot 0 was already visited by a forward walk
+        if (next == 0 || next == limit)
+        {
+          limit = std::min(limit, ind);
+        }
+        ind = next;
+        next = (next + 1) % slots_.size();
+      }
+      slots_[ind] = Slot();
+      item_cnt_--;
+      return Iter(this, pos.index_, limit);
     }
 
-    return Iter(this, next_ind);
+    slots_[pos.index_].state = SlotState::DELETED;
+    item_cnt_--;
+    return Iter(this, pos.index_ + 1, pos.limit_);
   }
 
-  template< typename Key, typename T, typename Hash, typename Equal >
-  typename HashTable< Key, T, Hash, Equal >::Iter HashTable< Key, T, Hash, Equal >::erase(cIter first, cIter last) noexcept
+  template< typename Key, typename T, typename Hash, typename Equal, bool RobinHood >
+  typename HashTable< Key, T, Hash, Equal, RobinHood >::Iter HashTable< Key, T, Hash, Equal, RobinHood >::erase(cIter first, cIter last) noexcept
   {
     auto it = first;
     while (it != last)
@@ -450,19 +542,76 @@ namespace demehin
     return Iter(this, first.index_);
   }
 
-  template< typename Key, typename T, typename Hash, typename Equal >
-  void HashTable< Key, T, Hash, Equal >::clear() noexcept
+  template< typename Key, typename T, typename Hash, typename Equal, bool RobinHood >
+  void HashTable< Key, T, Hash, Equal, RobinHood >::clear() noexcept
   {
-    erase(cbegin(), cend());
+    for (size_t i = 0; i < slots_.size(); i++)
+    {
+      slots_[i] = Slot();
+    }
+    item_cnt_ = 0;
   }
 
-  template< typename Key, typename T, typename Hash, typename Equal >
-  void HashTable< Key, T, Hash, Equal >::swap(HashTable& other) noexcept
+  template< typename Key, typename T, typename Hash, typename Equal, bool RobinHood >
+  void HashTable< Key, T, Hash, Equal, RobinHood >::swap(HashTable& other) noexcept
   {
     std::swap(slots_, other.slots_);
     std::swap(item_cnt_, other.item_cnt_);
     std::swap(hasher_, other.hasher_);
     std::swap(equal_, other.equal_);
+    std::swap(max_load_factor_, other.max_load_factor_);
+    std::swap(rehash_cnt_, other.rehash_cnt_);
+  }
+
+  template< typename Key, typename T, typename Hash, typename Equal, bool RobinHood >
+  size_t HashTable< Key, T, Hash, Equal, RobinHood >::probeLength(size_t index) const
+  {
+    if (RobinHood)
+    {
+      return slots_[index].dist + 1;
+    }
+
+    size_t hash_val = homeIndex(slots_[index].pair.first, slots_.size());
+    size_t ind = hash_val;
+    size_t i = 1;
+    while (ind != index && i <= slots_.size())
+    {
+      ind = (hash_val + i * (i + 1) / 2) % slots_.size();
+      i++;
+    }
+    return i;
+  }
+
+  template< typename Key, typename T, typename Hash, typename Equal, bool RobinHood >
+  HashTableStats HashTable< Key, T, Hash, Equal, RobinHood >::stats() const
+  {
+    const size_t groups = std::min< size_t >(16, slots_.size());
+    HashTableStats res{ item_cnt_, slots_.size(), 0, rehash_cnt_, 0, 0.0, DynamicArray< size_t >(groups) };
+    for (size_t i = 0; i < groups; i++)
+    {
+      res.occupancy[i] = 0;
+    }
+
+    size_t total_probe = 0;
+    for (size_t i = 0; i < slots_.size(); i++)
+    {
+      if (slots_[i].state == SlotState::DELETED)
+      {
+        res.tombstones++;
+      }
+      else if (slots_[i].state == SlotState::OCCUPIED)
+      {
+        size_t probe = probeLength(i);
+        total_probe += probe;
+        res.max_probe = std::max(res.max_probe, probe);
+        res.occupancy[i * groups / slots_.size()]++;
+      }
+    }
+    if (item_cnt_ != 0)
+    {
+      res.avg_probe = static_cast< double >(total_probe) / item_cnt_;
+    }
+    return res;
   }
 }
 
@@ -2,35 +2,38 @@
 #define HASH_TABLE_ITERATOR
 #include <type_traits>
 #include <cstddef>
+#include <limits>
 #include <utility>
 
 namespace demehin
 {
-  template< typename Key, typename T, typename Hash, typename Equal >
+  template< typename Key, typename T, typename Hash, typename Equal, bool RobinHood >
   class HashTable;
 
-  template< typename Key, typename T, typename Hash, typename Equal, bool isConst >
+  template< typename Key, typename T, typename Hash, typename Equal, bool RobinHood, bool isConst >
   class HashTIterator
   {
-    friend class HashTable< Key, T, Hash, Equal >;
-    friend class HashTIterator< Key, T, Hash, Equal, true >;
-    friend class HashTIterator< Key, T, Hash, Equal, false >;
+    friend class HashTable< Key, T, Hash, Equal, RobinHood >;
+    friend class HashTIterator< Key, T, Hash, Equal, RobinHood, true >;
+    friend class HashTIterator< Key, T, Hash, Equal, RobinHood, false >;
   public:
-    using this_t = HashTIterator< Key, T, Hash, Equal, isConst >;
+    using this_t = HashTIterator< Key, T, Hash, Equal, RobinHood, isConst >;
     using Val = typename std::conditional< isConst, const std::pair< Key, T >, std::pair< Key, T > >::type;
     using Ref = typename std::conditional< isConst, const std::pair< Key, T >&, std::pair< Key, T >& >::type;
     using Ptr = typename std::conditional< isConst, const std::pair< Key, T >*, std::pair< Key, T >* >::type;
-    using Table = typename std::conditional< isConst, const HashTable< Key, T, Hash, Equal >, HashTable< Key, T, Hash, Equal > >::type;
+    using Table = typename std::conditional< isConst, const HashTable< Key, T, Hash, Equal, RobinHood >, HashTable< Key, T, Hash, Equal, RobinHood > >::type;
 
     HashTIterator() noexcept:
       table_(nullptr),
-      index_(0)
+      index_(0),
+      limit_(std::numeric_limits< size_t >::max())
     {}
 
     template< bool OtherConst, typename = std::enable_if_t< isConst || !OtherConst > >
-    HashTIterator(const HashTIterator< Key, T, Hash, Equal, OtherConst >& other) noexcept:
+    HashTIterator(const HashTIterator< Key, T, Hash, Equal, RobinHood, OtherConst >& other) noexcept:
       table_(other.table_),
-      index_(other.index_)
+      index_(other.index_),
+      limit_(other.limit_)
     {}
 
     this_t& operator++() noexcept
@@ -70,20 +73,26 @@ namespace demehin
   private:
     Table* table_;
     size_t index_;
+    size_t limit_;
 
-    HashTIterator(Table* table, size_t index) noexcept:
+    HashTIterator(Table* table, size_t index, size_t limit = std::numeric_limits< size_t >::max()) noexcept:
       table_(table),
-      index_(index)
+      index_(index),
+      limit_(limit)
     {
       skipEmpty();
     }
 
     void skipEmpty() noexcept
     {
-      while (index_ < table_->slots_.size() && table_->slots_[index_].state != HashTable< Key, T, Hash, Equal >::SlotState::OCCUPIED)
+      while (index_ < table_->slots_.size() && table_->slots_[index_].state != HashTable< Key, T, Hash, Equal, RobinHood >::SlotState::OCCUPIED)
       {
         ++index_;
       }
+      if (index_ >= limit_)
+      {
+        index_ = table_->slots_.size();
+      }
     }
   };
 }
@@ -24,7 +24,8 @@ namespace
         in >> from >> to >> weight;
         gr.addEdge(from, to, weight);
       }
-      graphs[name] = gr;
+      gr.freeze();
+      graphs[name] = std::move(gr);
     }
   }
 }
@@ -45,6 +46,7 @@ int main(int argc, char* argv[])
   cmds["vertexes"] = std::bind(demehin::printVertexesNames, std::ref(std::cout), std::ref(std::cin), std::cref(mapOfGraphs));
   cmds["outbound"]  = std::bind(demehin::printOutbounds, std::ref(std::cout), std::ref(std::cin), std::cref(mapOfGraphs));
   cmds["inbound"] = std::bind(demehin::printInbounds, std::ref(std::cout), std::ref(std::cin), std::cref(mapOfGraphs));
+  cmds["stats"] = std::bind(demehin::printStats, std::ref(std::cout), std::ref(std::cin), std::cref(mapOfGraphs));
   cmds["bind"] = std::bind(demehin::bind, std::ref(std::cin), std::ref(mapOfGraphs));
   cmds["cut"] = std::bind(demehin::cut, std::ref(std::cin), std::ref(mapOfGraphs));
   cmds["create"] = std::bind(demehin::create, std::ref(std::cin), std::ref(mapOfGraphs));
@@ -0,0 +1,118 @@
+#include <boost/test/unit_test.hpp>
+#include <sstream>
+#include "graph.hpp"
+
+namespace
+{
+  std::string joinBounds(const demehin::Tree< std::string, demehin::Tree< unsigned int, size_t > >& bounds)
+  {
+    std::ostringstream out;
+    for (auto it = bounds.cbegin(); it != bounds.cend(); it++)
+    {
+      out << it->first;
+      for (auto weightIt = it->second.cbegin(); weightIt != it->second.cend(); weightIt++)
+      {
+        out << ":" << weightIt->first << "x" << weightIt->second;
+      }
+      out << " ";
+    }
+    return out.str();
+  }
+}
+
+BOOST_AUTO_TEST_CASE(graph_bounds_test)
+{
+  demehin::Graph gr;
+  gr.addEdge("a", "b", 1);
+  gr.addEdge("a", "b", 1);
+  gr.addEdge("a", "c", 2);
+  gr.addEdge("c", "a", 3);
+  gr.addVertex("d");
+
+  BOOST_TEST(gr.getVrts().size() == 4);
+  BOOST_TEST(gr.hasVrt("d"));
+  BOOST_TEST(!gr.hasVrt("e"));
+  BOOST_TEST(joinBounds(gr.getOutbounds("a")) == "b:1x2 c:2x1 ");
+  BOOST_TEST(joinBounds(gr.getInbounds("a")) == "c:3x1 ");
+  BOOST_TEST(joinBounds(gr.getInbounds("b")) == "a:1x2 ");
+  BOOST_TEST(joinBounds(gr.getOutbounds("d")) == "d:0x1 ");
+  BOOST_TEST(gr.getOutbounds("e").empty());
+}
+
+BOOST_AUTO_TEST_CASE(graph_delete_edge_test)
+{
+  demehin::Graph gr;
+  gr.addEdge("a", "b", 1);
+  gr.addEdge("a", "b", 2);
+  gr.addEdge("a", "c", 1);
+
+  BOOST_TEST(!gr.deleteEdge("a", "b", 3));
+  BOOST_TEST(gr.deleteEdge("a", "b", 1));
+  BOOST_TEST(joinBounds(gr.getOutbounds("a")) == "b:2x1 c:1x1 ");
+  BOOST_TEST(gr.deleteEdge("a", "b", 2));
+  BOOST_TEST(joinBounds(gr.getOutbounds("a")) == "c:1x1 ");
+  BOOST_TEST(gr.getInbounds("b").empty());
+  BOOST_TEST(gr.hasVrt("b"));
+  BOOST_TEST(gr.getVrts().size() == 3);
+}
+
+BOOST_AUTO_TEST_CASE(graph_vertex_ids_test)
+{
+  demehin::IdPairHash hash;
+  BOOST_TEST(hash(std::make_pair(1u, 2u)) != hash(std::make_pair(2u, 1u)));
+  BOOST_TEST(hash(std::make_pair(1u, 1u)) != hash(std::make_pair(2u, 2u)));
+
+  demehin::Graph gr;
+  gr.addEdge("b", "a", 1);
+  gr.addEdge("a", "b", 2);
+  gr.addEdge("b", "a", 3);
+  BOOST_TEST(gr.getEdges().size() == 2);
+
+  demehin::Graph::VertexId a = 0;
+  demehin::Graph::VertexId b = 0;
+  BOOST_TEST(gr.findId("a", a));
+  BOOST_TEST(gr.findId("b", b));
+  BOOST_TEST(gr.getName(a) == "a");
+  BOOST_TEST(gr.getName(b) == "b");
+  BOOST_TEST(gr.getEdges().at(std::make_pair(b, a)).size() == 2);
+
+  demehin::Graph merged;
+  merged.addVertex("c");
+  merged.addEdges(gr);
+  merged.addEdges(gr);
+  BOOST_TEST(merged.getVrts().size() == 3);
+  BOOST_TEST(joinBounds(merged.getOutbounds("b")) == "a:1x2:3x2 ");
+  BOOST_TEST(joinBounds(merged.getInbounds("b")) == "a:2x2 ");
+}
+
+BOOST_AUTO_TEST_CASE(graph_snapshot_test)
+{
+  demehin::Graph gr;
+  gr.addEdge("a", "b", 1);
+  gr.addEdge("a", "b", 1);
+  gr.addEdge("a", "c", 2);
+  gr.addEdge("c", "a", 3);
+  BOOST_TEST(!gr.isFrozen());
+  std::string outbounds = joinBounds(gr.getOutbounds("a"));
+  std::string inbounds = joinBounds(gr.getInbounds("a"));
+
+  const demehin::GraphSnapshot& snapshot = gr.freeze();
+  BOOST_TEST(gr.isFrozen());
+  BOOST_TEST(snapshot.outOffsets.size() == 4);
+  BOOST_TEST(snapshot.outOffsets[3] == 4);
+  BOOST_TEST(snapshot.inOffsets[3] == 4);
+  BOOST_TEST(joinBounds(gr.getOutbounds("a")) == outbounds);
+  BOOST_TEST(joinBounds(gr.getInbounds("a")) == inbounds);
+
+  BOOST_TEST(!gr.deleteEdge("a", "c", 5));
+  BOOST_TEST(gr.isFrozen());
+  BOOST_TEST(gr.deleteEdge("a", "b", 1));
+  BOOST_TEST(!gr.isFrozen());
+  gr.addEdge("d", "a", 4);
+  BOOST_TEST(gr.getVrts().size() == 4);
+  BOOST_TEST(!gr.isFrozen());
+  BOOST_TEST(joinBounds(gr.getOutbounds("a")) == "c:2x1 ");
+  BOOST_TEST(joinBounds(gr.getInbounds("a")) == "c:3x1 d:4x1 ");
+  BOOST_TEST(gr.freeze().outOffsets.size() == 5);
+  BOOST_TEST(gr.freeze().inOffsets[4] == 3);
+}
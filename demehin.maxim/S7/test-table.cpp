@@ -1,6 +1,19 @@
 #include <boost/test/unit_test.hpp>
+#include <algorithm>
+#include <vector>
 #include "hash_table.hpp"
 
+namespace
+{
+  struct GroupHash
+  {
+    size_t operator()(int key) const
+    {
+      return key / 8;
+    }
+  };
+}
+
 BOOST_AUTO_TEST_CASE(insert_and_access_test)
 {
   demehin::HashTable< int, std::string > table;
@@ -97,6 +110,24 @@ BOOST_AUTO_TEST_CASE(rehash_test)
   }
 }
 
+BOOST_AUTO_TEST_CASE(rehash_power_of_two_test)
+{
+  demehin::HashTable< int, int > table;
+  table.max_load_factor(0.95);
+  table.rehash(100);
+  BOOST_TEST(table.stats().capacity == 128);
+
+  for (int i = 0; i < 90; i++)
+  {
+    table[i * 12800] = i;
+  }
+  BOOST_TEST(table.size() == 90);
+  for (int i = 0; i < 90; i++)
+  {
+    BOOST_TEST(table.at(i * 12800) == i);
+  }
+}
+
 BOOST_AUTO_TEST_CASE(load_factor_test)
 {
   demehin::HashTable< int, int > table;
@@ -114,3 +145,139 @@ BOOST_AUTO_TEST_CASE(load_factor_test)
   table.max_load_factor(0.5);
   BOOST_TEST(table.max_load_factor() == 0.5);
 }
+
+BOOST_AUTO_TEST_CASE(robin_hood_test)
+{
+  using RobinHoodTable = demehin::HashTable< int, std::string, std::hash< int >, std::equal_to< int >, true >;
+  RobinHoodTable table;
+
+  for (int i = 0; i < 100; i++)
+  {
+    table[i] = std::to_string(i);
+  }
+  BOOST_TEST(table.size() == 100);
+  BOOST_TEST(table.load_factor() <= table.max_load_factor());
+  BOOST_TEST(!table.insert(std::make_pair(42, "x")).second);
+
+  for (int i = 0; i < 100; i += 2)
+  {
+    BOOST_TEST(table.erase(i) == 1);
+  }
+  BOOST_TEST(table.size() == 50);
+  BOOST_TEST(table.erase(0) == 0);
+
+  size_t visited = 0;
+  for (auto it = table.cbegin(); it != table.cend(); it++)
+  {
+    BOOST_TEST(it->first % 2 == 1);
+    visited++;
+  }
+  BOOST_TEST(visited == 50);
+
+  for (int i = 1; i < 100; i += 2)
+  {
+    BOOST_TEST(table.at(i) == std::to_string(i));
+  }
+  BOOST_TEST((table.find(50) == table.end()));
+
+  table.clear();
+  BOOST_TEST(table.empty());
+  BOOST_TEST((table.find(1) == table.end()));
+}
+
+BOOST_AUTO_TEST_CASE(robin_hood_churn_test)
+{
+  using RobinHoodTable = demehin::HashTable< int, int, std::hash< int >, std::equal_to< int >, true >;
+  RobinHoodTable table;
+
+  for (int i = 0; i < 64; i++)
+  {
+    table[i] = i;
+  }
+  for (int i = 64; i < 10000; i++)
+  {
+    BOOST_TEST(table.erase(i - 64) == 1);
+    table[i] = i;
+  }
+  BOOST_TEST(table.size() == 64);
+  for (int i = 10000 - 64; i < 10000; i++)
+  {
+    BOOST_TEST(table.at(i) == i);
+  }
+  table.erase(table.begin(), table.end());
+  BOOST_TEST(table.empty());
+}
+
+BOOST_AUTO_TEST_CASE(robin_hood_erase_while_iterating_test)
+{
+  using RobinHoodTable = demehin::HashTable< int, int, GroupHash, std::equal_to< int >, true >;
+  for (int count = 1; count < 300; count++)
+  {
+    for (int step = 2; step < 6; step++)
+    {
+      RobinHoodTable table;
+      for (int i = 0; i < count; i++)
+      {
+        table[i] = 0;
+      }
+      std::vector< int > visits(count, 0);
+      for (auto it = table.begin(); it != table.end();)
+      {
+        visits[it->first]++;
+        if (it->first % step != 0)
+        {
+          it = table.erase(it);
+        }
+        else
+        {
+          ++it;
+        }
+      }
+      BOOST_TEST(std::count(visits.begin(), visits.end(), 1) == count);
+      BOOST_TEST(table.size() == static_cast< size_t >((count + step - 1) / step));
+    }
+  }
+}
+
+BOOST_AUTO_TEST_CASE(stats_test)
+{
+  demehin::HashTable< int, int > table;
+  demehin::HashTableStats empty = table.stats();
+  BOOST_TEST(empty.size == 0);
+  BOOST_TEST(empty.capacity == 16);
+  BOOST_TEST(empty.max_probe == 0);
+  BOOST_TEST(empty.rehashes == 0);
+  BOOST_TEST(empty.occupancy.size() == 16);
+
+  for (int i = 0; i < 100; i++)
+  {
+    table[i * 16] = i;
+  }
+  for (int i = 0; i < 40; i++)
+  {
+    table.erase(i * 16);
+  }
+  demehin::HashTableStats st = table.stats();
+  BOOST_TEST(st.size == 60);
+  BOOST_TEST(st.rehashes > 0);
+  BOOST_TEST(st.tombstones == 40);
+  BOOST_TEST(st.max_probe >= 1);
+  BOOST_TEST(st.avg_probe >= 1.0);
+  size_t occupied = 0;
+  for (size_t i = 0; i < st.occupancy.size(); i++)
+  {
+    occupied += st.occupancy[i];
+  }
+  BOOST_TEST(occupied == 60);
+
+  demehin::HashTable< int, int, std::hash< int >, std::equal_to< int >, true > robin;
+  for (int i = 0; i < 100; i++)
+  {
+    robin[i] = i;
+  }
+  robin.erase(5);
+  demehin::HashTableStats rst = robin.stats();
+  BOOST_TEST(rst.size == 99);
+  BOOST_TEST(rst.tombstones == 0);
+  BOOST_TEST(rst.max_probe >= 1);
+}
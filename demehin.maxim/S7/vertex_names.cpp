@@ -0,0 +1,40 @@
+#include "vertex_names.hpp"
+
+demehin::VertexNames::Id demehin::VertexNames::intern(const std::string& name)
+{
+  auto res = ids_.insert(std::make_pair(name, static_cast< Id >(names_.size())));
+  if (res.second)
+  {
+    try
+    {
+      names_.push(name);
+    }
+    catch (...)
+    {
+      ids_.erase(res.first);
+      throw;
+    }
+  }
+  return res.first->second;
+}
+
+bool demehin::VertexNames::find(const std::string& name, Id& id) const
+{
+  auto it = ids_.find(name);
+  if (it == ids_.cend())
+  {
+    return false;
+  }
+  id = it->second;
+  return true;
+}
+
+const std::string& demehin::VertexNames::name(Id id) const noexcept
+{
+  return names_[id];
+}
+
+size_t demehin::VertexNames::size() const noexcept
+{
+  return names_.size();
+}
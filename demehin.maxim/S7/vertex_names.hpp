@@ -0,0 +1,26 @@
+#ifndef VERTEX_NAMES_HPP
+#define VERTEX_NAMES_HPP
+#include <cstdint>
+#include <string>
+#include <dynamic_array.hpp>
+#include "hash_table.hpp"
+
+namespace demehin
+{
+  class VertexNames
+  {
+  public:
+    using Id = uint32_t;
+
+    Id intern(const std::string&);
+    bool find(const std::string&, Id&) const;
+    const std::string& name(Id) const noexcept;
+    size_t size() const noexcept;
+
+  private:
+    HashTable< std::string, Id > ids_;
+    DynamicArray< std::string > names_;
+  };
+}
+
+#endif
@@ -1,29 +1,79 @@
 #ifndef DATA_UTILS_HPP
 #define DATA_UTILS_HPP
 #include <cstddef>
+#include <new>
 #include <stdexcept>
+#include <utility>
 
 namespace demehin::details
 {
   template< typename T >
-  T* copyData(const T* data, size_t size)
+  T* allocateData(size_t capacity)
   {
-    T* cpyData = new T[size];
+    return static_cast< T* >(::operator new(capacity * sizeof(T)));
+  }
+
+  template< typename T >
+  void destroyData(T* data, size_t size) noexcept
+  {
+    for (size_t i = 0; i < size; i++)
+    {
+      data[i].~T();
+    }
+  }
+
+  template< typename T >
+  void deallocateData(T* data) noexcept
+  {
+    ::operator delete(data);
+  }
+
+  template< typename T >
+  void freeData(T* data, size_t size) noexcept
+  {
+    destroyData(data, size);
+    deallocateData(data);
+  }
+
+  template< typename T >
+  T* copyData(const T* data, size_t size, size_t capacity)
+  {
+    T* cpyData = allocateData< T >(capacity);
+    size_t i = 0;
     try
     {
-      for (size_t i = 0; i < size; i++)
+      for (; i < size; i++)
       {
-        cpyData[i] = data[i];
+        new (cpyData + i) T(data[i]);
       }
     }
-    catch (const std::bad_alloc&)
+    catch (...)
     {
-      delete[] cpyData;
+      freeData(cpyData, i);
       throw;
     }
-
     return cpyData;
   }
+
+  template< typename T >
+  T* relocateData(T* data, size_t size, size_t capacity)
+  {
+    T* newData = allocateData< T >(capacity);
+    size_t i = 0;
+    try
+    {
+      for (; i < size; i++)
+      {
+        new (newData + i) T(std::move_if_noexcept(data[i]));
+      }
+    }
+    catch (...)
+    {
+      freeData(newData, i);
+      throw;
+    }
+    return newData;
+  }
 }
 
 #endif
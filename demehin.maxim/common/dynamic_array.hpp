@@ -30,6 +30,7 @@ namespace demehin
     ~DynamicArray();
 
     void push(const T& rhs);
+    void push(T&& rhs);
 
     void pop_back();
     void pop_front();
@@ -52,6 +53,7 @@ namespace demehin
     void swap(DynamicArray&) noexcept;
 
     void clear();
+    void reserve(size_t);
 
   private:
     T* data_;
@@ -60,6 +62,7 @@ namespace demehin
     size_t begin_;
 
     void resize();
+    void reallocate(size_t);
   };
 
   template< typename T >
@@ -69,23 +72,36 @@ namespace demehin
     capacity_(100),
     begin_(0)
   {
-    data_ = new T[capacity_];
+    data_ = details::allocateData< T >(capacity_);
   }
 
   template< typename T >
   DynamicArray< T >::DynamicArray(size_t size):
-    data_(new T[size]),
-    size_(size),
+    data_(details::allocateData< T >(size)),
+    size_(0),
     capacity_(size),
     begin_(0)
-  {}
+  {
+    try
+    {
+      for (; size_ < size; size_++)
+      {
+        new (data_ + size_) T();
+      }
+    }
+    catch (...)
+    {
+      details::freeData(data_, size_);
+      throw;
+    }
+  }
 
   template< typename T >
   DynamicArray< T >::DynamicArray(const DynamicArray& other):
-    data_(details::copyData(other.data_ + other.begin_, other.size_)),
+    data_(details::copyData(other.data_ + other.begin_, other.size_, other.size_)),
     size_(other.size_),
-    capacity_(other.capacity_),
-    begin_(other.begin_)
+    capacity_(other.size_),
+    begin_(0)
   {}
 
   template< typename T >
@@ -115,7 +131,7 @@ namespace demehin
       data_[i] = std::move(data_[i + 1]);
     }
 
-    size_--;
+    pop_back();
     return Iter(data_ + begin_ + ind);
   }
 
@@ -156,7 +172,8 @@ namespace demehin
   template< typename T >
   DynamicArray< T >::~DynamicArray()
   {
-    delete[] data_;
+    details::destroyData(data_ + begin_, size_);
+    details::deallocateData(data_);
   }
 
   template< typename T >
@@ -164,9 +181,31 @@ namespace demehin
   {
     if (size_ + begin_ >= capacity_)
     {
+      T copy(value);
+      resize();
+      new (data_ + begin_ + size_) T(std::move(copy));
+    }
+    else
+    {
+      new (data_ + begin_ + size_) T(value);
+    }
+    size_++;
+  }
+
+  template< typename T >
+  void DynamicArray< T >::push(T&& value)
+  {
+    if (size_ + begin_ >= capacity_)
+    {
+      T temp(std::move(value));
       resize();
+      new (data_ + begin_ + size_) T(std::move(temp));
     }
-    data_[size_++] = value;
+    else
+    {
+      new (data_ + begin_ + size_) T(std::move(value));
+    }
+    size_++;
   }
 
   template< typename T >
@@ -176,6 +215,7 @@ namespace demehin
     {
       throw std::logic_error("empty");
     }
+    data_[begin_ + size_ - 1].~T();
     size_--;
   }
 
@@ -186,6 +226,7 @@ namespace demehin
     {
       throw std::logic_error("empty");
     }
+    data_[begin_].~T();
     begin_++;
     size_--;
   }
@@ -278,19 +319,40 @@ namespace demehin
   template< typename T >
   void DynamicArray< T >::clear()
   {
-    while (!empty())
+    details::destroyData(data_ + begin_, size_);
+    size_ = 0;
+    begin_ = 0;
+  }
+
+  template< typename T >
+  void DynamicArray< T >::reserve(size_t capacity)
+  {
+    if (capacity > capacity_ - begin_)
     {
-      pop_back();
+      reallocate(capacity);
     }
   }
 
   template< typename T >
   void DynamicArray< T >::resize()
   {
-    capacity_ *= 2;
-    T* newData = details::copyData(data_, capacity_);
-    delete[] data_;
+    size_t newCapacity = (size_ * 2 > capacity_) ? size_ * 2 : capacity_;
+    if (newCapacity == 0)
+    {
+      newCapacity = 1;
+    }
+    reallocate(newCapacity);
+  }
+
+  template< typename T >
+  void DynamicArray< T >::reallocate(size_t newCapacity)
+  {
+    T* newData = details::relocateData(data_ + begin_, size_, newCapacity);
+    details::destroyData(data_ + begin_, size_);
+    details::deallocateData(data_);
     data_ = newData;
+    capacity_ = newCapacity;
+    begin_ = 0;
   }
 }
 
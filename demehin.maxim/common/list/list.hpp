@@ -1,12 +1,14 @@
 #ifndef LIST_HPP
 #define LIST_HPP
+#include <memory>
 #include <utility>
 #include "list_iterator.hpp"
 #include "list_node.hpp"
+#include "node_pool.hpp"
 
 namespace demehin
 {
-  template< typename T >
+  template< typename T, typename Alloc = std::allocator< T > >
   struct List
   {
   public:
@@ -14,8 +16,8 @@ namespace demehin
     using cIter = ListIterator< T, true >;
 
     List();
-    List(const List< T >&);
-    List(List< T >&&);
+    List(const List< T, Alloc >&);
+    List(List< T, Alloc >&&);
 
     List(size_t, const T&);
     explicit List(std::initializer_list< T >);
@@ -24,14 +26,14 @@ namespace demehin
 
     ~List();
 
-    List< T >& operator=(const List< T >&);
-    List< T >& operator=(List< T >&&) noexcept;
-    bool operator==(const List< T >&) const noexcept;
-    bool operator!=(const List< T >&) const noexcept;
-    bool operator<(const List< T >&) const noexcept;
-    bool operator<=(const List< T >&) const noexcept;
-    bool operator>(const List< T >&) const noexcept;
-    bool operator>=(const List< T >&) const noexcept;
+    List< T, Alloc >& operator=(const List< T, Alloc >&);
+    List< T, Alloc >& operator=(List< T, Alloc >&&) noexcept;
+    bool operator==(const List< T, Alloc >&) const noexcept;
+    bool operator!=(const List< T, Alloc >&) const noexcept;
+    bool operator<(const List< T, Alloc >&) const noexcept;
+    bool operator<=(const List< T, Alloc >&) const noexcept;
+    bool operator>(const List< T, Alloc >&) const noexcept;
+    bool operator>=(const List< T, Alloc >&) const noexcept;
 
     Iter begin() const noexcept;
     Iter end() const noexcept;
@@ -58,12 +60,12 @@ namespace demehin
 
     void swap(List&) noexcept;
 
-    void splice(cIter pos, List< T >&) noexcept;
-    void splice(cIter pos, List< T >&&) noexcept;
-    void splice(cIter pos, List< T >&, cIter it) noexcept;
-    void splice(cIter pos, List< T >&&, cIter it) noexcept;
-    void splice(cIter pos, List< T >&, cIter first, cIter last) noexcept;
-    void splice(cIter pos, List< T >&&, cIter first, cIter last) noexcept;
+    void splice(cIter pos, List< T, Alloc >&);
+    void splice(cIter pos, List< T, Alloc >&&);
+    void splice(cIter pos, List< T, Alloc >&, cIter it);
+    void splice(cIter pos, List< T, Alloc >&&, cIter it);
+    void splice(cIter pos, List< T, Alloc >&, cIter first, cIter last);
+    void splice(cIter pos, List< T, Alloc >&&, cIter first, cIter last);
 
     void fill(Iter first, Iter last, const T&) noexcept;
 
@@ -90,76 +92,84 @@ namespace demehin
 
   private:
     using Node = demehin::Node< T >;
+    using NodeAlloc = typename std::allocator_traits< Alloc >::template rebind_alloc< Node >;
+    using NodeTraits = std::allocator_traits< NodeAlloc >;
 
+    NodeAlloc alloc_;
     Node* fake_;
     Node* tail_;
     size_t size_;
 
+    explicit List(const NodeAlloc&);
+    Node* createNode(const T&, Node*, Node*);
+    void destroyNode(Node*) noexcept;
   };
 
   template< typename T >
   using Node = demehin::Node< T >;
 
-  template< typename T >
-  List< T >::List():
-    fake_(reinterpret_cast< Node* >(new char[sizeof(Node)])),
+  template< typename T, typename Alloc >
+  List< T, Alloc >::List():
+    List(NodeAlloc())
+  {}
+
+  template< typename T, typename Alloc >
+  List< T, Alloc >::List(const NodeAlloc& alloc):
+    alloc_(alloc),
+    fake_(new Node()),
     tail_(fake_),
     size_(0)
-  {
-    fake_->next = fake_;
-    fake_->prev = fake_;
-  }
+  {}
 
-  template< typename T >
-  List< T >::List(size_t count, const T& value):
+  template< typename T, typename Alloc >
+  List< T, Alloc >::List(size_t count, const T& value):
     List()
   {
     assign(count, value);
   }
 
-  template< typename T >
-  List< T >::List(std::initializer_list< T > ilist):
+  template< typename T, typename Alloc >
+  List< T, Alloc >::List(std::initializer_list< T > ilist):
     List()
   {
     assign(ilist);
   }
 
-  template< typename T >
+  template< typename T, typename Alloc >
   template< typename InputIt >
-  List< T >::List(InputIt first, InputIt last):
+  List< T, Alloc >::List(InputIt first, InputIt last):
     List()
   {
     assign(first, last);
   }
 
-  template< typename T >
-  List< T >::~List()
+  template< typename T, typename Alloc >
+  List< T, Alloc >::~List()
   {
     clear();
-    delete[] reinterpret_cast< char* >(fake_);
+    delete fake_;
   }
 
-  template< typename T >
-  List< T >& List< T >::operator=(const List< T >& other)
+  template< typename T, typename Alloc >
+  List< T, Alloc >& List< T, Alloc >::operator=(const List< T, Alloc >& other)
   {
     assign(other.begin(), other.end());
     return *this;
   }
 
-  template< typename T >
-  List< T >& List< T >::operator=(List< T >&& other) noexcept
+  template< typename T, typename Alloc >
+  List< T, Alloc >& List< T, Alloc >::operator=(List< T, Alloc >&& other) noexcept
   {
     if (this != std::addressof(other))
     {
-      tail_ = std::exchange(other.tail_, nullptr);
-      fake_ = std::exchange(other.fake_, nullptr);
-      size_ = std::exchange(other.size_, 0);
+      List< T, Alloc > temp(std::move(other));
+      swap(temp);
     }
     return *this;
   }
 
-  template< typename T >
-  bool List< T >::operator==(const List< T >& rhs) const noexcept
+  template< typename T, typename Alloc >
+  bool List< T, Alloc >::operator==(const List< T, Alloc >& rhs) const noexcept
   {
     if (size() != rhs.size())
     {
@@ -180,14 +190,14 @@ namespace demehin
     return true;
   }
 
-  template< typename T >
-  bool List< T >::operator!=(const List< T >& rhs) const noexcept
+  template< typename T, typename Alloc >
+  bool List< T, Alloc >::operator!=(const List< T, Alloc >& rhs) const noexcept
   {
     return !(*this == rhs);
   }
 
-  template< typename T >
-  bool List< T >::operator>(const List< T >& rhs) const noexcept
+  template< typename T, typename Alloc >
+  bool List< T, Alloc >::operator>(const List< T, Alloc >& rhs) const noexcept
   {
     auto it1 = begin();
     auto it2 = rhs.begin();
@@ -208,26 +218,26 @@ namespace demehin
     return size() > rhs.size();
   }
 
-  template< typename T >
-  bool List< T >::operator<=(const List< T >& rhs) const noexcept
+  template< typename T, typename Alloc >
+  bool List< T, Alloc >::operator<=(const List< T, Alloc >& rhs) const noexcept
   {
     return !(*this > rhs);
   }
 
-  template< typename T >
-  bool List< T >::operator<(const List< T >& rhs) const noexcept
+  template< typename T, typename Alloc >
+  bool List< T, Alloc >::operator<(const List< T, Alloc >& rhs) const noexcept
   {
     return rhs > *this;
   }
 
-  template< typename T >
-  bool List< T >::operator>=(const List< T >& rhs) const noexcept
+  template< typename T, typename Alloc >
+  bool List< T, Alloc >::operator>=(const List< T, Alloc >& rhs) const noexcept
   {
     return !(*this < rhs);
   }
 
-  template< typename T >
-  void List< T >::clear() noexcept
+  template< typename T, typename Alloc >
+  void List< T, Alloc >::clear() noexcept
   {
     while (!empty())
     {
@@ -235,9 +245,9 @@ namespace demehin
     }
   }
 
-  template< typename T >
-  List< T >::List(const List< T >& rhs):
-    List()
+  template< typename T, typename Alloc >
+  List< T, Alloc >::List(const List< T, Alloc >& rhs):
+    List(NodeTraits::select_on_container_copy_construction(rhs.alloc_))
   {
     Node* current = rhs.fake_->next;
     while (current != rhs.fake_)
@@ -247,107 +257,109 @@ namespace demehin
     }
   }
 
-  template< typename T >
-  List< T >::List(List< T >&& rhs):
+  template< typename T, typename Alloc >
+  List< T, Alloc >::List(List< T, Alloc >&& rhs):
+    alloc_(rhs.alloc_),
     fake_(std::exchange(rhs.fake_, nullptr)),
     tail_(std::exchange(rhs.tail_, nullptr)),
     size_(std::exchange(rhs.size_, 0))
   {}
 
-  template< typename T >
-  typename List< T >::Iter List< T >::begin() const noexcept
+  template< typename T, typename Alloc >
+  typename List< T, Alloc >::Iter List< T, Alloc >::begin() const noexcept
   {
     return Iter(fake_->next);
   }
 
-  template< typename T >
-  typename List< T >::Iter List< T >::end() const noexcept
+  template< typename T, typename Alloc >
+  typename List< T, Alloc >::Iter List< T, Alloc >::end() const noexcept
   {
     return Iter(fake_);
   }
 
-  template< typename T >
-  typename List< T >::cIter List< T >::cbegin() const noexcept
+  template< typename T, typename Alloc >
+  typename List< T, Alloc >::cIter List< T, Alloc >::cbegin() const noexcept
   {
     return cIter(fake_->next);
   }
 
-  template< typename T >
-  typename List< T >::cIter List< T >::cend() const noexcept
+  template< typename T, typename Alloc >
+  typename List< T, Alloc >::cIter List< T, Alloc >::cend() const noexcept
   {
     return cIter(fake_);
   }
 
-  template< typename T >
-  void List< T >::pop_front() noexcept
+  template< typename T, typename Alloc >
+  void List< T, Alloc >::pop_front() noexcept
   {
     erase(cbegin());
   }
 
-  template< typename T >
-  void List< T >::pop_back() noexcept
+  template< typename T, typename Alloc >
+  void List< T, Alloc >::pop_back() noexcept
   {
     erase(cIter(tail_));
   }
 
-  template< typename T >
-  void List< T >::push_back(const T& data)
+  template< typename T, typename Alloc >
+  void List< T, Alloc >::push_back(const T& data)
   {
     insert(cend(), data);
   }
 
-  template< typename T >
-  void List< T >::push_front(const T& data)
+  template< typename T, typename Alloc >
+  void List< T, Alloc >::push_front(const T& data)
   {
     insert(cbegin(), data);
   }
 
-  template< typename T >
-  const T& List< T >::front() const noexcept
+  template< typename T, typename Alloc >
+  const T& List< T, Alloc >::front() const noexcept
   {
     return fake_->next->data;
   }
 
-  template< typename T >
-  T& List< T >::front() noexcept
+  template< typename T, typename Alloc >
+  T& List< T, Alloc >::front() noexcept
   {
     return fake_->next->data;
   }
 
-  template< typename T >
-  const T& List< T >::back() const noexcept
+  template< typename T, typename Alloc >
+  const T& List< T, Alloc >::back() const noexcept
   {
     return tail_->data;
   }
 
-  template< typename T >
-  T& List< T >::back() noexcept
+  template< typename T, typename Alloc >
+  T& List< T, Alloc >::back() noexcept
   {
     return tail_->data;
   }
 
-  template< typename T >
-  size_t List< T >::size() const noexcept
+  template< typename T, typename Alloc >
+  size_t List< T, Alloc >::size() const noexcept
   {
     return size_;
   }
 
-  template< typename T >
-  bool List< T >::empty() const noexcept
+  template< typename T, typename Alloc >
+  bool List< T, Alloc >::empty() const noexcept
   {
     return size_ == 0;
   }
 
-  template< typename T >
-  void List< T >::swap(List< T >& other) noexcept
+  template< typename T, typename Alloc >
+  void List< T, Alloc >::swap(List< T, Alloc >& other) noexcept
   {
+    std::swap(alloc_, other.alloc_);
     std::swap(fake_, other.fake_);
     std::swap(tail_, other.tail_);
     std::swap(size_, other.size_);
   }
 
-  template< typename T >
-  void List< T >::fill(Iter first, Iter last, const T& value) noexcept
+  template< typename T, typename Alloc >
+  void List< T, Alloc >::fill(Iter first, Iter last, const T& value) noexcept
   {
     for (; first != last; ++first)
     {
@@ -355,42 +367,51 @@ namespace demehin
     }
   }
 
-  template < typename T >
-  void List< T >::splice(cIter pos, List< T >& other) noexcept
+  template< typename T, typename Alloc >
+  void List< T, Alloc >::splice(cIter pos, List< T, Alloc >& other)
   {
     splice(pos, other, other.cbegin(), other.cend());
   }
 
-  template < typename T >
-  void List< T >::splice(cIter pos, List< T >&& other) noexcept
+  template< typename T, typename Alloc >
+  void List< T, Alloc >::splice(cIter pos, List< T, Alloc >&& other)
   {
     splice(pos, other);
   }
 
-  template < typename T >
-  void List< T >::splice(cIter pos, List< T >& other, cIter it) noexcept
+  template< typename T, typename Alloc >
+  void List< T, Alloc >::splice(cIter pos, List< T, Alloc >& other, cIter it)
   {
     auto it2 = it;
     splice(pos, other, it, ++it2);
   }
 
-  template < typename T >
-  void List< T >::splice(cIter pos, List< T >&& other, cIter it) noexcept
+  template< typename T, typename Alloc >
+  void List< T, Alloc >::splice(cIter pos, List< T, Alloc >&& other, cIter it)
   {
     splice(pos, other, it);
   }
 
-  template < typename T >
-  void List< T >::splice(cIter pos, List< T >& other, cIter first, cIter last) noexcept
+  template< typename T, typename Alloc >
+  void List< T, Alloc >::splice(cIter pos, List< T, Alloc >& other, cIter first, cIter last)
   {
     if (first == last || other.empty() || &other == this)
     {
-        return;
+      return;
+    }
+    if (alloc_ != other.alloc_)
+    {
+      while (first != last)
+      {
+        insert(pos, std::move(first.getNode()->data));
+        first = other.erase(first);
+      }
+      return;
     }
 
-    Node* posNode = pos.getNode();
+    Node* posNode = pos.getNode() ? pos.getNode() : fake_;
     Node* firstNode = first.getNode();
-    Node* lastNode = (last.getNode() != nullptr) ? last.getNode()->prev : other.tail_;
+    Node* lastNode = last.getNode()->prev;
 
     size_t count = 0;
     for (auto it = first; it != last; it++)
@@ -398,54 +419,28 @@ namespace demehin
       count++;
     }
 
-    if (firstNode->prev)
-    {
-      firstNode->prev->next = last.getNode();
-    }
-    else
-    {
-      other.fake_->next = last.getNode();
-    }
-
-    if (last.getNode())
-    {
-      last.getNode()->prev = firstNode->prev;
-    }
-    else
-    {
-      other.tail_ = firstNode->prev;
-    }
+    firstNode->prev->next = last.getNode();
+    last.getNode()->prev = firstNode->prev;
 
     firstNode->prev = posNode->prev;
     lastNode->next = posNode;
-
-    if (posNode->prev)
-    {
-      posNode->prev->next = firstNode;
-    }
-    else
-    {
-      fake_->next = firstNode;
-    }
+    posNode->prev->next = firstNode;
     posNode->prev = lastNode;
 
-    if (posNode == fake_->next)
-    {
-      tail_ = lastNode;
-    }
-
+    tail_ = fake_->prev;
+    other.tail_ = other.fake_->prev;
     other.size_ -= count;
     size_ += count;
   }
 
-  template < typename T >
-  void List< T >::splice(cIter pos, List< T >&& other, cIter first, cIter last) noexcept
+  template< typename T, typename Alloc >
+  void List< T, Alloc >::splice(cIter pos, List< T, Alloc >&& other, cIter first, cIter last)
   {
     splice(pos, other, first, last);
   }
 
-  template< typename T >
-  void List< T >::remove(const T& value) noexcept
+  template< typename T, typename Alloc >
+  void List< T, Alloc >::remove(const T& value) noexcept
   {
     for (auto it = cbegin(); it != cend();)
     {
@@ -460,9 +455,9 @@ namespace demehin
     }
   }
 
-  template< typename T >
+  template< typename T, typename Alloc >
   template< typename UnaryPredicate >
-  void List< T >::removeIf(UnaryPredicate p) noexcept
+  void List< T, Alloc >::removeIf(UnaryPredicate p) noexcept
   {
     for (auto it = cbegin(); it != cend();)
     {
@@ -477,10 +472,10 @@ namespace demehin
     }
   }
 
-  template< typename T >
-  void List< T >::assign(size_t count, const T& value)
+  template< typename T, typename Alloc >
+  void List< T, Alloc >::assign(size_t count, const T& value)
   {
-    List< T > temp;
+    List< T, Alloc > temp(alloc_);
     for (size_t i = 0; i < count; i++)
     {
       temp.push_back(value);
@@ -488,11 +483,11 @@ namespace demehin
     swap(temp);
   }
 
-  template< typename T >
+  template< typename T, typename Alloc >
   template< typename InputIt >
-  void List< T >::assign(InputIt first, InputIt last)
+  void List< T, Alloc >::assign(InputIt first, InputIt last)
   {
-    List< T > temp;
+    List< T, Alloc > temp(alloc_);
     for (auto it = first; it != last; it++)
     {
       temp.push_back(*it);
@@ -500,14 +495,14 @@ namespace demehin
     swap(temp);
   }
 
-  template< typename T >
-  void List< T >::assign(std::initializer_list< T > ilist)
+  template< typename T, typename Alloc >
+  void List< T, Alloc >::assign(std::initializer_list< T > ilist)
   {
     assign(ilist.begin(), ilist.end());
   }
 
-  template< typename T >
-  typename List< T >::Iter List< T >::erase(cIter pos) noexcept
+  template< typename T, typename Alloc >
+  typename List< T, Alloc >::Iter List< T, Alloc >::erase(cIter pos) noexcept
   {
     Node* todelete = pos.getNode();
     if (todelete == fake_)
@@ -527,26 +522,25 @@ namespace demehin
       fake_->next = todelete->next;
     }
     size_--;
-    delete todelete;
+    destroyNode(todelete);
     return toreturn;
   }
 
-  template< typename T >
-  typename List< T >::Iter List< T >::erase(cIter first, cIter last) noexcept
+  template< typename T, typename Alloc >
+  typename List< T, Alloc >::Iter List< T, Alloc >::erase(cIter first, cIter last) noexcept
   {
-    Iter toreturn;
-    for (auto it = first; it != last; it++)
+    while (first != last)
     {
-      toreturn = erase(it);
+      first = cIter(erase(first).getNode());
     }
-    return toreturn;
+    return Iter(last.getNode());
   }
 
-  template< typename T >
-  typename List< T >::Iter List< T >::insert(cIter pos, const T& value)
+  template< typename T, typename Alloc >
+  typename List< T, Alloc >::Iter List< T, Alloc >::insert(cIter pos, const T& value)
   {
     Node* posNode = pos.getNode() ? pos.getNode() : fake_;
-    Node* newNode = new Node(value, posNode->prev, posNode);
+    Node* newNode = createNode(value, posNode->prev, posNode);
     posNode->prev->next = newNode;
     posNode->prev = newNode;
 
@@ -562,15 +556,15 @@ namespace demehin
     return Iter(newNode);
   }
 
-  template< typename T >
-  typename List< T >::Iter List< T >::insert(cIter pos, T&& value)
+  template< typename T, typename Alloc >
+  typename List< T, Alloc >::Iter List< T, Alloc >::insert(cIter pos, T&& value)
   {
     T temp_val = std::move(value);
     return insert(pos, temp_val);
   }
 
-  template< typename T >
-  typename List< T >::Iter List< T >::insert(cIter pos, size_t count, const T& value)
+  template< typename T, typename Alloc >
+  typename List< T, Alloc >::Iter List< T, Alloc >::insert(cIter pos, size_t count, const T& value)
   {
     if (count == 0)
     {
@@ -580,15 +574,16 @@ namespace demehin
     Iter toreturn = insert(pos, value);
     if (count != 1)
     {
-      List< T > values(--count, value);
+      List< T, Alloc > values(alloc_);
+      values.assign(--count, value);
       splice(pos, values);
     }
     return toreturn;
   }
 
-  template< typename T >
+  template< typename T, typename Alloc >
   template< typename InputIt >
-  typename List< T >::Iter List< T >::insert(cIter pos, InputIt first, InputIt last)
+  typename List< T, Alloc >::Iter List< T, Alloc >::insert(cIter pos, InputIt first, InputIt last)
   {
     if (first == last)
     {
@@ -596,13 +591,14 @@ namespace demehin
     }
 
     Iter result = insert(pos, *first);
-    List< T > tempList(++first, last);
+    List< T, Alloc > tempList(alloc_);
+    tempList.assign(++first, last);
     splice(pos, tempList);
     return result;
   }
 
-  template< typename T >
-  typename List< T >::Iter List< T >::insert(cIter pos, std::initializer_list< T > ilist)
+  template< typename T, typename Alloc >
+  typename List< T, Alloc >::Iter List< T, Alloc >::insert(cIter pos, std::initializer_list< T > ilist)
   {
     if (ilist.size() == 0)
     {
@@ -612,8 +608,32 @@ namespace demehin
     return insert(pos, ilist.begin(), ilist.end());
   }
 
-  template< typename T >
-  void List< T >::reverse() noexcept
+  template< typename T, typename Alloc >
+  typename List< T, Alloc >::Node* List< T, Alloc >::createNode(const T& value, Node* prev, Node* next)
+  {
+    Node* node = NodeTraits::allocate(alloc_, 1);
+    try
+    {
+      NodeTraits::construct(alloc_, node, value, prev, next);
+    }
+    catch (...)
+    {
+      NodeTraits::deallocate(alloc_, node, 1);
+      throw;
+    }
+    return node;
+  }
+
+  template< typename T, typename Alloc >
+  void List< T, Alloc >::destroyNode(Node* node) noexcept
+  {
+    node->data.~T();
+    NodeTraits::destroy(alloc_, node);
+    NodeTraits::deallocate(alloc_, node, 1);
+  }
+
+  template< typename T, typename Alloc >
+  void List< T, Alloc >::reverse() noexcept
   {
     if (size() <= 1)
     {
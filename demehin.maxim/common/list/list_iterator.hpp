@@ -6,15 +6,16 @@
 
 namespace demehin
 {
-  template< typename T >
-  class List;
+  template< typename T, typename Alloc >
+  struct List;
 
   template< typename T, bool isConst >
   struct ListIterator: public std::iterator< std::bidirectional_iterator_tag, T >
   {
     friend class ListIterator< T, true >;
     friend class ListIterator< T, false >;
-    friend class List< T >;
+    template< typename, typename >
+    friend struct List;
   public:
     using this_t = ListIterator< T, isConst >;
     using Value = typename std::conditional< isConst, const T&, T& >::type;
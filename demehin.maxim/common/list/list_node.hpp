@@ -6,14 +6,26 @@ namespace demehin
   template< typename T >
   struct Node
   {
-    T data;
+    // the sentinel is built by Node() and never holds data; List destroys data of value nodes
+    union
+    {
+      T data;
+    };
     Node< T >* prev;
     Node< T >* next;
 
+    Node() noexcept;
     explicit Node(const T&) noexcept;
     Node(const T&, Node< T >*, Node< T >*) noexcept;
+    ~Node();
   };
 
+  template< typename T >
+  Node< T >::Node() noexcept:
+    prev(this),
+    next(this)
+  {}
+
   template< typename T >
   Node< T >::Node(const T& value) noexcept:
     data(value),
@@ -27,6 +39,10 @@ namespace demehin
     prev(prev_ptr),
     next(next_ptr)
   {}
+
+  template< typename T >
+  Node< T >::~Node()
+  {}
 }
 
 #endif
@@ -0,0 +1,243 @@
+#ifndef NODE_POOL_HPP
+#define NODE_POOL_HPP
+#include <cstddef>
+#include <memory>
+#include <new>
+#include <type_traits>
+
+namespace demehin
+{
+  template< typename T >
+  class NodePool
+  {
+  public:
+    NodePool() noexcept;
+    NodePool(const NodePool&) = delete;
+    ~NodePool();
+
+    NodePool& operator=(const NodePool&) = delete;
+
+    T* allocate();
+    void deallocate(T*) noexcept;
+
+    size_t live() const noexcept;
+    size_t slabs() const noexcept;
+
+  private:
+    union Cell
+    {
+      Cell* next;
+      alignas(T) unsigned char storage[sizeof(T)];
+    };
+
+    struct Slab
+    {
+      Slab* next;
+      Cell* cells;
+    };
+
+    static constexpr size_t minSlabSize = 16;
+    static constexpr size_t maxSlabSize = 4096;
+
+    Slab* slabs_;
+    Cell* free_;
+    Cell* cursor_;
+    Cell* end_;
+    size_t slab_size_;
+    size_t live_;
+
+    void addSlab();
+    void releaseSlabs(Slab*) noexcept;
+  };
+
+  template< typename T >
+  class PoolAllocator
+  {
+    template< typename U >
+    friend class PoolAllocator;
+  public:
+    using value_type = T;
+    using propagate_on_container_move_assignment = std::true_type;
+    using propagate_on_container_swap = std::true_type;
+
+    PoolAllocator();
+    template< typename U >
+    PoolAllocator(const PoolAllocator< U >&);
+
+    T* allocate(size_t);
+    void deallocate(T*, size_t) noexcept;
+
+    PoolAllocator select_on_container_copy_construction() const;
+    const NodePool< T >& pool() const noexcept;
+
+    template< typename U >
+    bool operator==(const PoolAllocator< U >&) const noexcept;
+    template< typename U >
+    bool operator!=(const PoolAllocator< U >&) const noexcept;
+
+  private:
+    std::shared_ptr< NodePool< T > > pool_;
+  };
+
+  template< typename T >
+  NodePool< T >::NodePool() noexcept:
+    slabs_(nullptr),
+    free_(nullptr),
+    cursor_(nullptr),
+    end_(nullptr),
+    slab_size_(minSlabSize),
+    live_(0)
+  {}
+
+  template< typename T >
+  NodePool< T >::~NodePool()
+  {
+    releaseSlabs(slabs_);
+  }
+
+  template< typename T >
+  T* NodePool< T >::allocate()
+  {
+    Cell* cell = free_;
+    if (cell)
+    {
+      free_ = cell->next;
+    }
+    else
+    {
+      if (cursor_ == end_)
+      {
+        addSlab();
+      }
+      cell = cursor_++;
+    }
+    live_++;
+    return reinterpret_cast< T* >(cell->storage);
+  }
+
+  template< typename T >
+  void NodePool< T >::deallocate(T* ptr) noexcept
+  {
+    Cell* cell = reinterpret_cast< Cell* >(ptr);
+    cell->next = free_;
+    free_ = cell;
+    if (--live_ == 0)
+    {
+      releaseSlabs(slabs_->next);
+      slabs_->next = nullptr;
+      free_ = nullptr;
+      cursor_ = slabs_->cells;
+    }
+  }
+
+  template< typename T >
+  size_t NodePool< T >::live() const noexcept
+  {
+    return live_;
+  }
+
+  template< typename T >
+  size_t NodePool< T >::slabs() const noexcept
+  {
+    size_t cnt = 0;
+    for (Slab* slab = slabs_; slab; slab = slab->next)
+    {
+      cnt++;
+    }
+    return cnt;
+  }
+
+  template< typename T >
+  void NodePool< T >::addSlab()
+  {
+    Slab* slab = new Slab{ slabs_, nullptr };
+    try
+    {
+      slab->cells = new Cell[slab_size_];
+    }
+    catch (...)
+    {
+      delete slab;
+      throw;
+    }
+    slabs_ = slab;
+    cursor_ = slab->cells;
+    end_ = slab->cells + slab_size_;
+    if (slab_size_ < maxSlabSize)
+    {
+      slab_size_ *= 2;
+    }
+  }
+
+  template< typename T >
+  void NodePool< T >::releaseSlabs(Slab* slab) noexcept
+  {
+    while (slab)
+    {
+      Slab* next = slab->next;
+      delete[] slab->cells;
+      delete slab;
+      slab = next;
+    }
+  }
+
+  template< typename T >
+  PoolAllocator< T >::PoolAllocator():
+    pool_(std::make_shared< NodePool< T > >())
+  {}
+
+  template< typename T >
+  template< typename U >
+  PoolAllocator< T >::PoolAllocator(const PoolAllocator< U >&):
+    PoolAllocator()
+  {}
+
+  template< typename T >
+  T* PoolAllocator< T >::allocate(size_t n)
+  {
+    if (n != 1)
+    {
+      return static_cast< T* >(::operator new(n * sizeof(T)));
+    }
+    return pool_->allocate();
+  }
+
+  template< typename T >
+  void PoolAllocator< T >::deallocate(T* ptr, size_t n) noexcept
+  {
+    if (n != 1)
+    {
+      ::operator delete(ptr);
+      return;
+    }
+    pool_->deallocate(ptr);
+  }
+
+  template< typename T >
+  PoolAllocator< T > PoolAllocator< T >::select_on_container_copy_construction() const
+  {
+    return PoolAllocator< T >();
+  }
+
+  template< typename T >
+  const NodePool< T >& PoolAllocator< T >::pool() const noexcept
+  {
+    return *pool_;
+  }
+
+  template< typename T >
+  template< typename U >
+  bool PoolAllocator< T >::operator==(const PoolAllocator< U >& rhs) const noexcept
+  {
+    return static_cast< const void* >(pool_.get()) == static_cast< const void* >(rhs.pool_.get());
+  }
+
+  template< typename T >
+  template< typename U >
+  bool PoolAllocator< T >::operator!=(const PoolAllocator< U >& rhs) const noexcept
+  {
+    return !(*this == rhs);
+  }
+}
+
+#endif
@@ -33,6 +33,7 @@ namespace demehin
     size_t size() const noexcept;
 
     void clear();
+    void reserve(size_t);
 
   private:
     DynamicArray< T > data_;
@@ -91,6 +92,12 @@ namespace demehin
   {
     data_.clear();
   }
+
+  template< typename T >
+  void Queue< T >::reserve(size_t capacity)
+  {
+    data_.reserve(capacity);
+  }
 }
 
 #endif
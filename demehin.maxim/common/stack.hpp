@@ -29,6 +29,8 @@ namespace demehin
     bool empty() const noexcept;
     size_t size() const noexcept;
 
+    void clear();
+
   private:
     DynamicArray< T > data_;
   };
@@ -68,6 +70,12 @@ namespace demehin
   {
     return data_.size();
   }
+
+  template< typename T >
+  void Stack< T >::clear()
+  {
+    data_.clear();
+  }
 }
 
 #endif
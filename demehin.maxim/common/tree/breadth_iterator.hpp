@@ -7,7 +7,7 @@
 
 namespace demehin
 {
-  template< typename Key, typename T, typename Cmp >
+  template< typename Key, typename T, typename Cmp, bool Augmented >
   class Tree;
 
   template< typename Key, typename T, typename Cmp, bool isConst >
@@ -15,7 +15,8 @@ namespace demehin
   {
     friend class BreadthIterator< Key, T, Cmp, true >;
     friend class BreadthIterator< Key, T, Cmp, false >;
-    friend class Tree< Key, T, Cmp >;
+    template< typename, typename, typename, bool >
+    friend class Tree;
   public:
     using Node = demehin::TreeNode< Key, T >;
     using this_t = BreadthIterator< Key, T, Cmp, isConst >;
@@ -5,7 +5,7 @@
 
 namespace demehin
 {
-  template< typename Key, typename T, typename Cmp >
+  template< typename Key, typename T, typename Cmp, bool Augmented >
   class Tree;
 
   template< typename Key, typename T, typename Cmp >
@@ -13,7 +13,8 @@ namespace demehin
   template< typename Key, typename T, typename Cmp >
   class TreeConstIterator
   {
-    friend class Tree< Key, T, Cmp >;
+    template< typename, typename, typename, bool >
+    friend class Tree;
     friend class TreeIterator< Key, T, Cmp >;
   public:
     using this_t = TreeConstIterator< Key, T, Cmp >;
@@ -5,7 +5,7 @@
 
 namespace demehin
 {
-  template< typename Key, typename T, typename Cmp >
+  template< typename Key, typename T, typename Cmp, bool Augmented >
   class Tree;
 
   template< typename Key, typename T, typename Cmp >
@@ -14,7 +14,8 @@ namespace demehin
   template< typename Key, typename T, typename Cmp >
   class TreeIterator
   {
-    friend class Tree< Key, T, Cmp >;
+    template< typename, typename, typename, bool >
+    friend class Tree;
     friend class TreeConstIterator< Key, T, Cmp >;
   public:
     using this_t = TreeIterator< Key, T, Cmp >;
@@ -1,9 +1,48 @@
 #ifndef NODE_HPP
 #define NODE_HPP
+#include <cstddef>
+#include <type_traits>
 #include <utility>
 
 namespace demehin
 {
+  namespace details
+  {
+    template< typename Key, bool = std::is_arithmetic< Key >::value >
+    struct SubtreeSum
+    {
+      using sum_t = Key;
+      using acc_t = Key;
+
+      void resetSum(const Key&) noexcept
+      {}
+
+      void addSum(const SubtreeSum&) noexcept
+      {}
+    };
+
+    template< typename Key >
+    struct SubtreeSum< Key, true >
+    {
+      using wide_t = typename std::conditional< std::is_signed< Key >::value, long long, unsigned long long >::type;
+      using sum_t = typename std::conditional< std::is_integral< Key >::value, wide_t, long double >::type;
+      using acc_t = typename std::conditional< std::is_integral< Key >::value, unsigned long long, long double >::type;
+
+      // integral keys are summed modulo 2^64, so range sums stay exact whenever the result fits in sum_t
+      acc_t sum;
+
+      void resetSum(const Key& key) noexcept
+      {
+        sum = static_cast< acc_t >(key);
+      }
+
+      void addSum(const SubtreeSum& child) noexcept
+      {
+        sum += child.sum;
+      }
+    };
+  }
+
   template< typename Key, typename T >
   struct TreeNode
   {
@@ -18,6 +57,15 @@ namespace demehin
 
   };
 
+  template< typename Key, typename T >
+  struct AugmentedTreeNode: TreeNode< Key, T >, details::SubtreeSum< Key >
+  {
+    size_t size;
+
+    template< typename... Args >
+    explicit AugmentedTreeNode(Args&&... args) noexcept;
+  };
+
   template< typename Key, typename T >
   template< typename... Args >
   TreeNode< Key, T >::TreeNode(Args&&... args) noexcept:
@@ -27,6 +75,15 @@ namespace demehin
     right(nullptr),
     height(1)
   {}
+
+  template< typename Key, typename T >
+  template< typename... Args >
+  AugmentedTreeNode< Key, T >::AugmentedTreeNode(Args&&... args) noexcept:
+    TreeNode< Key, T >(std::forward< Args >(args)...),
+    size(1)
+  {
+    this->resetSum(this->data.first);
+  }
 }
 
 #endif
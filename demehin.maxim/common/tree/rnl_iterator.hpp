@@ -2,11 +2,10 @@
 #define RNL_ITERATOR_HPP
 #include <cassert>
 #include <tree/node.hpp>
-#include <stack.hpp>
 
 namespace demehin
 {
-  template< typename Key, typename T, typename Cmp >
+  template< typename Key, typename T, typename Cmp, bool Augmented >
   class Tree;
 
   template< typename Key, typename T, typename Cmp, bool isConst >
@@ -14,12 +13,12 @@ namespace demehin
   {
     friend class RnlIterator< Key, T, Cmp, true >;
     friend class RnlIterator< Key, T, Cmp, false >;
-    friend class Tree< Key, T, Cmp >;
+    template< typename, typename, typename, bool >
+    friend class Tree;
   public:
     using Node = demehin::TreeNode< Key, T >;
     using this_t = RnlIterator< Key, T, Cmp, isConst >;
     using node_t = typename std::conditional< isConst, const Node, Node >::type;
-    using stack_t = typename std::conditional< isConst, Stack< const Node* >, Stack< Node* > >::type;
     using data_t = typename std::conditional< isConst, const std::pair< Key, T >, std::pair< Key, T > >::type;
 
     RnlIterator() noexcept;
@@ -35,21 +34,20 @@ namespace demehin
 
   private:
     node_t* node_;
-    stack_t stack_;
+
+    static bool isReal(node_t*) noexcept;
 
     explicit RnlIterator(node_t*) noexcept;
   };
 
   template< typename Key, typename T, typename Cmp, bool isConst >
   RnlIterator< Key, T, Cmp, isConst >::RnlIterator() noexcept:
-    node_(nullptr),
-    stack_()
+    node_(nullptr)
   {}
 
   template< typename Key, typename T, typename Cmp, bool isConst >
   RnlIterator< Key, T, Cmp, isConst >::RnlIterator(node_t* node) noexcept:
-    node_(node),
-    stack_()
+    node_(node)
   {}
 
   template< typename Key, typename T, typename Cmp, bool isConst >
@@ -60,28 +58,23 @@ namespace demehin
       return *this;
     }
 
-    if (node_->left != nullptr)
+    if (isReal(node_->left))
     {
-      stack_.push(node_);
       node_ = node_->left;
-      while (node_->right != nullptr)
+      while (isReal(node_->right))
       {
-        stack_.push(node_);
         node_ = node_->right;
       }
     }
     else
     {
-      while (!stack_.empty() && stack_.top()->left == node_)
-      {
-        node_ = stack_.top();
-        stack_.pop();
-      }
-      node_ = stack_.empty() ? nullptr : stack_.top();
-      if (!stack_.empty())
+      node_t* parent = node_->parent;
+      while (isReal(parent) && parent->left == node_)
       {
-        stack_.pop();
+        node_ = parent;
+        parent = parent->parent;
       }
+      node_ = isReal(parent) ? parent : nullptr;
     }
     return *this;
   }
@@ -119,6 +112,12 @@ namespace demehin
   {
     return !(*this == rhs);
   }
+
+  template< typename Key, typename T, typename Cmp, bool isConst >
+  bool RnlIterator< Key, T, Cmp, isConst >::isReal(node_t* node) noexcept
+  {
+    return node != nullptr && node->height != -1;
+  }
 }
 
 #endif
@@ -0,0 +1,115 @@
+#ifndef SET_OPERATIONS_HPP
+#define SET_OPERATIONS_HPP
+#include "tree.hpp"
+
+namespace demehin
+{
+  template< typename Key, typename T, typename Cmp, bool Augmented >
+  Tree< Key, T, Cmp, Augmented > set_union(const Tree< Key, T, Cmp, Augmented >&, const Tree< Key, T, Cmp, Augmented >&);
+
+  template< typename Key, typename T, typename Cmp, bool Augmented >
+  Tree< Key, T, Cmp, Augmented > set_intersection(const Tree< Key, T, Cmp, Augmented >&, const Tree< Key, T, Cmp, Augmented >&);
+
+  template< typename Key, typename T, typename Cmp, bool Augmented >
+  Tree< Key, T, Cmp, Augmented > set_difference(const Tree< Key, T, Cmp, Augmented >&, const Tree< Key, T, Cmp, Augmented >&);
+
+  namespace details
+  {
+    template< typename Key, typename T, typename Cmp, bool Augmented >
+    void appendBack(Tree< Key, T, Cmp, Augmented >& tree, typename Tree< Key, T, Cmp, Augmented >::Iter& last,
+      const std::pair< Key, T >& value)
+    {
+      last = tree.empty() ? tree.emplace(value).first : tree.emplace_hint(last, value);
+    }
+  }
+
+  template< typename Key, typename T, typename Cmp, bool Augmented >
+  Tree< Key, T, Cmp, Augmented > set_union(const Tree< Key, T, Cmp, Augmented >& lhs, const Tree< Key, T, Cmp, Augmented >& rhs)
+  {
+    Cmp cmp = lhs.key_comp();
+    Tree< Key, T, Cmp, Augmented > res(cmp);
+    auto last = res.end();
+    auto lIt = lhs.cbegin();
+    auto rIt = rhs.cbegin();
+    while (lIt != lhs.cend() && rIt != rhs.cend())
+    {
+      if (cmp(rIt->first, lIt->first))
+      {
+        details::appendBack(res, last, *rIt++);
+      }
+      else
+      {
+        if (!cmp(lIt->first, rIt->first))
+        {
+          ++rIt;
+        }
+        details::appendBack(res, last, *lIt++);
+      }
+    }
+    for (; lIt != lhs.cend(); ++lIt)
+    {
+      details::appendBack(res, last, *lIt);
+    }
+    for (; rIt != rhs.cend(); ++rIt)
+    {
+      details::appendBack(res, last, *rIt);
+    }
+    return res;
+  }
+
+  template< typename Key, typename T, typename Cmp, bool Augmented >
+  Tree< Key, T, Cmp, Augmented > set_intersection(const Tree< Key, T, Cmp, Augmented >& lhs, const Tree< Key, T, Cmp, Augmented >& rhs)
+  {
+    Cmp cmp = lhs.key_comp();
+    Tree< Key, T, Cmp, Augmented > res(cmp);
+    auto last = res.end();
+    auto lIt = lhs.cbegin();
+    auto rIt = rhs.cbegin();
+    while (lIt != lhs.cend() && rIt != rhs.cend())
+    {
+      if (cmp(lIt->first, rIt->first))
+      {
+        ++lIt;
+      }
+      else if (cmp(rIt->first, lIt->first))
+      {
+        ++rIt;
+      }
+      else
+      {
+        details::appendBack(res, last, *lIt++);
+        ++rIt;
+      }
+    }
+    return res;
+  }
+
+  template< typename Key, typename T, typename Cmp, bool Augmented >
+  Tree< Key, T, Cmp, Augmented > set_difference(const Tree< Key, T, Cmp, Augmented >& lhs, const Tree< Key, T, Cmp, Augmented >& rhs)
+  {
+    Cmp cmp = lhs.key_comp();
+    Tree< Key, T, Cmp, Augmented > res(cmp);
+    auto last = res.end();
+    auto lIt = lhs.cbegin();
+    auto rIt = rhs.cbegin();
+    while (lIt != lhs.cend())
+    {
+      if (rIt == rhs.cend() || cmp(lIt->first, rIt->first))
+      {
+        details::appendBack(res, last, *lIt++);
+      }
+      else if (cmp(rIt->first, lIt->first))
+      {
+        ++rIt;
+      }
+      else
+      {
+        ++lIt;
+        ++rIt;
+      }
+    }
+    return res;
+  }
+}
+
+#endif
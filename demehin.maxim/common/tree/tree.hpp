@@ -1,6 +1,7 @@
 #ifndef TREE_HPP
 #define TREE_HPP
 #include <functional>
+#include <type_traits>
 #include <utility>
 #include "node.hpp"
 #include "iterator.hpp"
@@ -8,10 +9,11 @@
 #include "lnr_iterator.hpp"
 #include "rnl_iterator.hpp"
 #include "breadth_iterator.hpp"
+#include <queue.hpp>
 
 namespace demehin
 {
-  template< typename Key, typename T, typename Cmp = std::less< Key > >
+  template< typename Key, typename T, typename Cmp = std::less< Key >, bool Augmented = false >
   class Tree
   {
   public:
@@ -20,6 +22,7 @@ namespace demehin
     using DataPair = std::pair< Key, T >;
     using IterPair = std::pair< Iter, Iter >;
     using cIterPair = std::pair< cIter, cIter >;
+    using sum_t = typename details::SubtreeSum< Key >::sum_t;
 
     using LnrIter = LnrIterator< Key, T, Cmp, false >;
     using cLnrIter = LnrIterator< Key, T, Cmp, true >;
@@ -29,8 +32,9 @@ namespace demehin
     using cBrIter = BreadthIterator< Key, T, Cmp, true >;
 
     Tree();
-    Tree(const Tree< Key, T, Cmp >&);
-    Tree(Tree< Key, T, Cmp >&&);
+    explicit Tree(const Cmp&);
+    Tree(const Tree< Key, T, Cmp, Augmented >&);
+    Tree(Tree< Key, T, Cmp, Augmented >&&) noexcept;
 
     template< typename InputIt >
     Tree(InputIt, InputIt);
@@ -39,8 +43,8 @@ namespace demehin
 
     ~Tree();
 
-    Tree< Key, T, Cmp >& operator=(const Tree< Key, T, Cmp >&);
-    Tree< Key, T, Cmp >& operator=(Tree< Key, T, Cmp >&&);
+    Tree< Key, T, Cmp, Augmented >& operator=(const Tree< Key, T, Cmp, Augmented >&);
+    Tree< Key, T, Cmp, Augmented >& operator=(Tree< Key, T, Cmp, Augmented >&&) noexcept;
 
     std::pair< Iter, bool > insert(const DataPair&);
     template< typename InputIt >
@@ -66,6 +70,7 @@ namespace demehin
     size_t size() const noexcept;
     bool empty() const noexcept;
     void clear() noexcept;
+    Cmp key_comp() const;
 
     size_t count(const Key&) const noexcept;
 
@@ -76,13 +81,19 @@ namespace demehin
     IterPair equal_range(const Key&) noexcept;
     cIterPair equal_range(const Key&) const noexcept;
 
+    size_t rank(const Key&) const noexcept;
+    Iter select(size_t) const noexcept;
+    size_t count_range(const Key&, const Key&) const noexcept;
+    sum_t sum_range(const Key&, const Key&) const noexcept;
+    sum_t key_sum() const noexcept;
+
     template< typename... Args >
     std::pair< Iter, bool > emplace(Args&&...);
 
     template< typename... Args >
     Iter emplace_hint(cIter, Args&&...);
 
-    void swap(Tree< Key, T, Cmp >&) noexcept;
+    void swap(Tree< Key, T, Cmp, Augmented >&) noexcept;
 
     LnrIter lnrBegin() const noexcept;
     LnrIter lnrEnd() const noexcept;
@@ -119,6 +130,9 @@ namespace demehin
 
   private:
     using Node = demehin::TreeNode< Key, T >;
+    using AugNode = demehin::AugmentedTreeNode< Key, T >;
+    using NodeType = typename std::conditional< Augmented, AugNode, Node >::type;
+    using acc_t = typename details::SubtreeSum< Key >::acc_t;
 
     Node* fakeRoot_;
     Node* root_;
@@ -126,22 +140,35 @@ namespace demehin
     size_t size_;
 
     int height(Node*) const noexcept;
+    size_t subtreeSize(Node*) const noexcept;
+    acc_t subtreeSum(Node*) const noexcept;
+    size_t countBelow(const Key&, bool) const noexcept;
+    acc_t sumBelow(const Key&, bool) const noexcept;
     Node* rotateRight(Node*) noexcept;
     Node* rotateLeft(Node*) noexcept;
     Node* balance(Node*) noexcept;
     void balanceUpper(Node*) noexcept;
     int getBalanceFactor(Node*) const noexcept;
-    void updateHeight(Node*) noexcept;
+    void updateNode(Node*) noexcept;
+    void updateAugment(Node*, std::false_type) noexcept;
+    void updateAugment(Node*, std::true_type) noexcept;
 
     template< typename Iterator, typename F >
     F traverse(F, Iterator, Iterator) const;
+    template< typename NodeT, typename F >
+    F traverseLevels(F) const;
   };
 
-  template< typename Key, typename T, typename Cmp >
-  Tree< Key, T, Cmp >::Tree():
+  template< typename Key, typename T, typename Cmp, bool Augmented >
+  Tree< Key, T, Cmp, Augmented >::Tree():
+    Tree(Cmp())
+  {}
+
+  template< typename Key, typename T, typename Cmp, bool Augmented >
+  Tree< Key, T, Cmp, Augmented >::Tree(const Cmp& cmp):
     fakeRoot_(reinterpret_cast< Node* >(new char[sizeof(Node)])),
     root_(fakeRoot_),
-    cmp_(),
+    cmp_(cmp),
     size_(0)
   {
     fakeRoot_->left = fakeRoot_->right = fakeRoot_;
@@ -149,9 +176,9 @@ namespace demehin
     fakeRoot_->parent = nullptr;
   }
 
-  template< typename Key, typename T, typename Cmp >
+  template< typename Key, typename T, typename Cmp, bool Augmented >
   template< typename InputIt >
-  Tree< Key, T, Cmp >::Tree(InputIt first, InputIt last):
+  Tree< Key, T, Cmp, Augmented >::Tree(InputIt first, InputIt last):
     Tree()
   {
     for (auto it = first; it != last; it++)
@@ -160,8 +187,8 @@ namespace demehin
     }
   }
 
-  template< typename Key, typename T, typename Cmp >
-  Tree< Key, T, Cmp >::Tree(std::initializer_list< DataPair > iList):
+  template< typename Key, typename T, typename Cmp, bool Augmented >
+  Tree< Key, T, Cmp, Augmented >::Tree(std::initializer_list< DataPair > iList):
     Tree()
   {
     for (auto it = iList.begin(); it != iList.end(); it++)
@@ -170,8 +197,8 @@ namespace demehin
     }
   }
 
-  template< typename Key, typename T, typename Cmp >
-  Tree< Key, T, Cmp >::Tree(const Tree< Key, T, Cmp >& other):
+  template< typename Key, typename T, typename Cmp, bool Augmented >
+  Tree< Key, T, Cmp, Augmented >::Tree(const Tree< Key, T, Cmp, Augmented >& other):
     fakeRoot_(reinterpret_cast< Node* >(new char[sizeof(Node)])),
     root_(fakeRoot_),
     cmp_(other.cmp_),
@@ -179,44 +206,45 @@ namespace demehin
   {
     fakeRoot_->left = fakeRoot_->right = fakeRoot_;
     fakeRoot_->height = -1;
+    fakeRoot_->parent = nullptr;
     for (auto it = other.begin(); it != other.end(); it++)
     {
       insert(*it);
     }
   }
 
-  template< typename Key, typename T, typename Cmp >
-  Tree< Key, T, Cmp >::Tree(Tree< Key, T, Cmp >&& other):
+  template< typename Key, typename T, typename Cmp, bool Augmented >
+  Tree< Key, T, Cmp, Augmented >::Tree(Tree< Key, T, Cmp, Augmented >&& other) noexcept:
     fakeRoot_(std::exchange(other.fakeRoot_, nullptr)),
     root_(std::exchange(other.root_, nullptr)),
     cmp_(std::move(other.cmp_)),
     size_(std::exchange(other.size_, 0))
   {}
 
-  template< typename Key, typename T, typename Cmp >
-  Tree< Key, T, Cmp >& Tree< Key, T, Cmp >::operator=(const Tree< Key, T, Cmp >& rhs)
+  template< typename Key, typename T, typename Cmp, bool Augmented >
+  Tree< Key, T, Cmp, Augmented >& Tree< Key, T, Cmp, Augmented >::operator=(const Tree< Key, T, Cmp, Augmented >& rhs)
   {
     if (this != std::addressof(rhs))
     {
-      Tree< Key, T, Cmp > temp(rhs);
+      Tree< Key, T, Cmp, Augmented > temp(rhs);
       swap(temp);
     }
     return *this;
   }
 
-  template< typename Key, typename T, typename Cmp >
-  Tree< Key, T, Cmp >& Tree< Key, T, Cmp >::operator=(Tree< Key, T, Cmp >&& rhs)
+  template< typename Key, typename T, typename Cmp, bool Augmented >
+  Tree< Key, T, Cmp, Augmented >& Tree< Key, T, Cmp, Augmented >::operator=(Tree< Key, T, Cmp, Augmented >&& rhs) noexcept
   {
     if (this != std::addressof(rhs))
     {
-      Tree< Key, T, Cmp > temp(std::move(rhs));
+      Tree< Key, T, Cmp, Augmented > temp(std::move(rhs));
       swap(temp);
     }
     return *this;
   }
 
-  template< typename Key, typename T, typename Cmp >
-  Tree< Key, T, Cmp >::~Tree()
+  template< typename Key, typename T, typename Cmp, bool Augmented >
+  Tree< Key, T, Cmp, Augmented >::~Tree()
   {
     if (fakeRoot_ != nullptr)
     {
@@ -225,8 +253,8 @@ namespace demehin
     }
   }
 
-  template< typename Key, typename T, typename Cmp >
-  void Tree< Key, T, Cmp >::clear() noexcept
+  template< typename Key, typename T, typename Cmp, bool Augmented >
+  void Tree< Key, T, Cmp, Augmented >::clear() noexcept
   {
     erase(cbegin(), cend());
     fakeRoot_->left = fakeRoot_->right = fakeRoot_;
@@ -234,23 +262,23 @@ namespace demehin
     size_ = 0;
   }
 
-  template< typename Key, typename T, typename Cmp >
-  std::pair< TreeIterator< Key, T, Cmp >, bool > Tree< Key, T, Cmp >::insert(const DataPair& value)
+  template< typename Key, typename T, typename Cmp, bool Augmented >
+  std::pair< TreeIterator< Key, T, Cmp >, bool > Tree< Key, T, Cmp, Augmented >::insert(const DataPair& value)
   {
     return emplace(value);
   }
 
-  template< typename Key, typename T, typename Cmp >
-  typename Tree< Key, T, Cmp >::Iter Tree< Key, T, Cmp >::insert(cIter hint, const DataPair& value)
+  template< typename Key, typename T, typename Cmp, bool Augmented >
+  typename Tree< Key, T, Cmp, Augmented >::Iter Tree< Key, T, Cmp, Augmented >::insert(cIter hint, const DataPair& value)
   {
     return emplace_hint(hint, value);
   }
 
-  template< typename Key, typename T, typename Cmp >
+  template< typename Key, typename T, typename Cmp, bool Augmented >
   template< typename InputIt >
-  void Tree< Key, T, Cmp >::insert(InputIt first, InputIt last)
+  void Tree< Key, T, Cmp, Augmented >::insert(InputIt first, InputIt last)
   {
-    Tree< Key, T, Cmp > temp(*this);
+    Tree< Key, T, Cmp, Augmented > temp(*this);
     for (; first != last; first++)
     {
       temp.insert(*first);
@@ -258,11 +286,11 @@ namespace demehin
     swap(temp);
   }
 
-  template< typename Key, typename T, typename Cmp >
+  template< typename Key, typename T, typename Cmp, bool Augmented >
   template< typename... Args >
-  std::pair< TreeIterator< Key, T, Cmp >, bool > Tree< Key, T, Cmp >::emplace(Args&&... args)
+  std::pair< TreeIterator< Key, T, Cmp >, bool > Tree< Key, T, Cmp, Augmented >::emplace(Args&&... args)
   {
-    Node* newNode = new Node(std::forward< Args >(args)...);
+    NodeType* newNode = new NodeType(std::forward< Args >(args)...);
     const Key& key = newNode->data.first;
 
     if (root_ == fakeRoot_)
@@ -312,9 +340,9 @@ namespace demehin
     return { Iter(newNode), true };
   }
 
-  template< typename Key, typename T, typename Cmp >
+  template< typename Key, typename T, typename Cmp, bool Augmented >
   template< typename... Args >
-  typename Tree< Key, T, Cmp >::Iter Tree< Key, T, Cmp >::emplace_hint(cIter hint, Args&&... args)
+  typename Tree< Key, T, Cmp, Augmented >::Iter Tree< Key, T, Cmp, Augmented >::emplace_hint(cIter hint, Args&&... args)
   {
     if (empty())
     {
@@ -332,10 +360,19 @@ namespace demehin
 
       if (cmp_(hintKey, newKey) && (nextHint == cend() || cmp_(newKey, nextHint->first)))
       {
-        Node* newNode = new Node(std::move(tempNode.data));
+        Node* newNode = new NodeType(std::move(tempNode.data));
         Node* hintNode = hint.getNode();
-        newNode->parent = hintNode;
-        hintNode->right = newNode;
+        if (hintNode->right == nullptr)
+        {
+          newNode->parent = hintNode;
+          hintNode->right = newNode;
+        }
+        else
+        {
+          Node* nextNode = nextHint.getNode();
+          newNode->parent = nextNode;
+          nextNode->left = newNode;
+        }
         balanceUpper(newNode);
         size_++;
         return Iter(newNode);
@@ -344,23 +381,56 @@ namespace demehin
     return emplace(std::move(tempNode.data)).first;
   }
 
-  template< typename Key, typename T, typename Cmp >
-  int Tree< Key, T, Cmp >::height(Node* node) const noexcept
+  template< typename Key, typename T, typename Cmp, bool Augmented >
+  int Tree< Key, T, Cmp, Augmented >::height(Node* node) const noexcept
   {
     return (node == fakeRoot_ || node == nullptr) ? -1 : node->height;
   }
 
-  template< typename Key, typename T, typename Cmp >
-  void Tree< Key, T, Cmp >::updateHeight(Node* node) noexcept
+  template< typename Key, typename T, typename Cmp, bool Augmented >
+  size_t Tree< Key, T, Cmp, Augmented >::subtreeSize(Node* node) const noexcept
+  {
+    return (node == fakeRoot_ || node == nullptr) ? 0 : static_cast< AugNode* >(node)->size;
+  }
+
+  template< typename Key, typename T, typename Cmp, bool Augmented >
+  typename Tree< Key, T, Cmp, Augmented >::acc_t Tree< Key, T, Cmp, Augmented >::subtreeSum(Node* node) const noexcept
+  {
+    return (node == fakeRoot_ || node == nullptr) ? acc_t() : static_cast< AugNode* >(node)->sum;
+  }
+
+  template< typename Key, typename T, typename Cmp, bool Augmented >
+  void Tree< Key, T, Cmp, Augmented >::updateNode(Node* node) noexcept
   {
     if (node != fakeRoot_ && node != nullptr)
     {
       node->height = 1 + std::max(height(node->left), height(node->right));
+      updateAugment(node, std::integral_constant< bool, Augmented >());
+    }
+  }
+
+  template< typename Key, typename T, typename Cmp, bool Augmented >
+  void Tree< Key, T, Cmp, Augmented >::updateAugment(Node*, std::false_type) noexcept
+  {}
+
+  template< typename Key, typename T, typename Cmp, bool Augmented >
+  void Tree< Key, T, Cmp, Augmented >::updateAugment(Node* node, std::true_type) noexcept
+  {
+    AugNode* aug = static_cast< AugNode* >(node);
+    aug->size = 1 + subtreeSize(node->left) + subtreeSize(node->right);
+    aug->resetSum(node->data.first);
+    if (node->left != nullptr)
+    {
+      aug->addSum(*static_cast< AugNode* >(node->left));
+    }
+    if (node->right != nullptr)
+    {
+      aug->addSum(*static_cast< AugNode* >(node->right));
     }
   }
 
-  template< typename Key, typename T, typename Cmp >
-  int Tree< Key, T, Cmp >::getBalanceFactor(Node* node) const noexcept
+  template< typename Key, typename T, typename Cmp, bool Augmented >
+  int Tree< Key, T, Cmp, Augmented >::getBalanceFactor(Node* node) const noexcept
   {
     if (node == fakeRoot_ || node == nullptr)
     {
@@ -369,8 +439,8 @@ namespace demehin
     return height(node->left) - height(node->right);
   }
 
-  template< typename Key, typename T, typename Cmp >
-  typename Tree< Key, T, Cmp >::Node* Tree< Key, T, Cmp >::rotateRight(Node* node) noexcept
+  template< typename Key, typename T, typename Cmp, bool Augmented >
+  typename Tree< Key, T, Cmp, Augmented >::Node* Tree< Key, T, Cmp, Augmented >::rotateRight(Node* node) noexcept
   {
     Node* lt = node->left;
     node->left = lt->right;
@@ -399,14 +469,14 @@ namespace demehin
       fakeRoot_->right = lt;
     }
 
-    updateHeight(node);
-    updateHeight(lt);
+    updateNode(node);
+    updateNode(lt);
 
     return lt;
   }
 
-  template< typename Key, typename T, typename Cmp >
-  typename Tree< Key, T, Cmp >::Node* Tree< Key, T, Cmp >::rotateLeft(Node* node) noexcept
+  template< typename Key, typename T, typename Cmp, bool Augmented >
+  typename Tree< Key, T, Cmp, Augmented >::Node* Tree< Key, T, Cmp, Augmented >::rotateLeft(Node* node) noexcept
   {
     Node* rt = node->right;
     node->right = rt->left;
@@ -436,16 +506,16 @@ namespace demehin
       fakeRoot_->right = rt;
     }
 
-    updateHeight(node);
-    updateHeight(rt);
+    updateNode(node);
+    updateNode(rt);
 
     return rt;
   }
 
-  template< typename Key, typename T, typename Cmp >
-  typename Tree< Key, T, Cmp >::Node* Tree< Key, T, Cmp >::balance(Node* node) noexcept
+  template< typename Key, typename T, typename Cmp, bool Augmented >
+  typename Tree< Key, T, Cmp, Augmented >::Node* Tree< Key, T, Cmp, Augmented >::balance(Node* node) noexcept
   {
-    updateHeight(node);
+    updateNode(node);
     int balanceFactor = getBalanceFactor(node);
 
     if (balanceFactor > 1)
@@ -469,8 +539,8 @@ namespace demehin
     return node;
   }
 
-  template< typename Key, typename T, typename Cmp >
-  void Tree< Key, T, Cmp >::balanceUpper(Node* node) noexcept
+  template< typename Key, typename T, typename Cmp, bool Augmented >
+  void Tree< Key, T, Cmp, Augmented >::balanceUpper(Node* node) noexcept
   {
     while (node != fakeRoot_)
     {
@@ -489,8 +559,8 @@ namespace demehin
     }
   }
 
-  template< typename Key, typename T, typename Cmp >
-  typename Tree< Key, T, Cmp >::Iter Tree< Key, T, Cmp >::erase(cIter pos) noexcept
+  template< typename Key, typename T, typename Cmp, bool Augmented >
+  typename Tree< Key, T, Cmp, Augmented >::Iter Tree< Key, T, Cmp, Augmented >::erase(cIter pos) noexcept
   {
     if (pos == cend())
     {
@@ -540,18 +610,18 @@ namespace demehin
 
     if (todelete == root_)
     {
-      root_ = (parent != fakeRoot_) ? parent : fakeRoot_;
+      root_ = (result != end()) ? result.getNode() : fakeRoot_;
       result = begin();
     }
 
-    delete todelete;
+    delete static_cast< NodeType* >(todelete);
     size_--;
     balanceUpper(parent);
     return result;
   }
 
-  template< typename Key, typename T, typename Cmp >
-  typename Tree< Key, T, Cmp >::Iter Tree< Key, T, Cmp >::erase(cIter first, cIter last) noexcept
+  template< typename Key, typename T, typename Cmp, bool Augmented >
+  typename Tree< Key, T, Cmp, Augmented >::Iter Tree< Key, T, Cmp, Augmented >::erase(cIter first, cIter last) noexcept
   {
     for (auto it = first; it != last;)
     {
@@ -560,8 +630,8 @@ namespace demehin
     return last;
   }
 
-  template< typename Key, typename T, typename Cmp >
-  size_t Tree< Key, T, Cmp >::erase(const Key& key) noexcept
+  template< typename Key, typename T, typename Cmp, bool Augmented >
+  size_t Tree< Key, T, Cmp, Augmented >::erase(const Key& key) noexcept
   {
     Iter it = find(key);
     if (it == end())
@@ -573,8 +643,8 @@ namespace demehin
     return 1;
   }
 
-  template< typename Key, typename T, typename Cmp >
-  typename Tree< Key, T, Cmp >::Iter Tree< Key, T, Cmp >::begin() const noexcept
+  template< typename Key, typename T, typename Cmp, bool Augmented >
+  typename Tree< Key, T, Cmp, Augmented >::Iter Tree< Key, T, Cmp, Augmented >::begin() const noexcept
   {
     if (empty())
     {
@@ -588,8 +658,8 @@ namespace demehin
     return Iter(current);
   }
 
-  template< typename Key, typename T, typename Cmp >
-  typename Tree< Key, T, Cmp >::cIter Tree< Key, T, Cmp >::cbegin() const noexcept
+  template< typename Key, typename T, typename Cmp, bool Augmented >
+  typename Tree< Key, T, Cmp, Augmented >::cIter Tree< Key, T, Cmp, Augmented >::cbegin() const noexcept
   {
     if (empty())
     {
@@ -603,20 +673,20 @@ namespace demehin
     return cIter(current);
   }
 
-  template< typename Key, typename T, typename Cmp >
-  typename Tree< Key, T, Cmp >::Iter Tree< Key, T, Cmp >::end() const noexcept
+  template< typename Key, typename T, typename Cmp, bool Augmented >
+  typename Tree< Key, T, Cmp, Augmented >::Iter Tree< Key, T, Cmp, Augmented >::end() const noexcept
   {
     return Iter(fakeRoot_);
   }
 
-  template< typename Key, typename T, typename Cmp >
-  typename Tree< Key, T, Cmp >::cIter Tree< Key, T, Cmp >::cend() const noexcept
+  template< typename Key, typename T, typename Cmp, bool Augmented >
+  typename Tree< Key, T, Cmp, Augmented >::cIter Tree< Key, T, Cmp, Augmented >::cend() const noexcept
   {
     return cIter(fakeRoot_);
   }
 
-  template< typename Key, typename T, typename Cmp >
-  T& Tree< Key, T, Cmp >::at(const Key& key)
+  template< typename Key, typename T, typename Cmp, bool Augmented >
+  T& Tree< Key, T, Cmp, Augmented >::at(const Key& key)
   {
     auto searched = find(key);
     if (searched == end())
@@ -626,8 +696,8 @@ namespace demehin
     return searched->second;
   }
 
-  template< typename Key, typename T, typename Cmp >
-  const T& Tree< Key, T, Cmp >::at(const Key& key) const
+  template< typename Key, typename T, typename Cmp, bool Augmented >
+  const T& Tree< Key, T, Cmp, Augmented >::at(const Key& key) const
   {
     auto searched = find(key);
     if (searched == end())
@@ -637,15 +707,15 @@ namespace demehin
     return searched->second;
   }
 
-  template< typename Key, typename T, typename Cmp >
-  T& Tree< Key, T, Cmp >::operator[](const Key& key)
+  template< typename Key, typename T, typename Cmp, bool Augmented >
+  T& Tree< Key, T, Cmp, Augmented >::operator[](const Key& key)
   {
     auto toreturn = insert(std::make_pair(key, T()));
     return toreturn.first->second;
   }
 
-  template< typename Key, typename T, typename Cmp >
-  typename Tree< Key, T, Cmp >::Iter Tree< Key, T, Cmp >::find(const Key& key) noexcept
+  template< typename Key, typename T, typename Cmp, bool Augmented >
+  typename Tree< Key, T, Cmp, Augmented >::Iter Tree< Key, T, Cmp, Augmented >::find(const Key& key) noexcept
   {
     Node* current = root_;
     while (current != nullptr && current != fakeRoot_)
@@ -666,8 +736,8 @@ namespace demehin
     return end();
   }
 
-  template< typename Key, typename T, typename Cmp >
-  typename Tree< Key, T, Cmp >::cIter Tree< Key, T, Cmp >::find(const Key& key) const noexcept
+  template< typename Key, typename T, typename Cmp, bool Augmented >
+  typename Tree< Key, T, Cmp, Augmented >::cIter Tree< Key, T, Cmp, Augmented >::find(const Key& key) const noexcept
   {
     Node* current = root_;
     while (current != nullptr && current != fakeRoot_)
@@ -688,20 +758,26 @@ namespace demehin
     return cend();
   }
 
-  template< typename Key, typename T, typename Cmp >
-  size_t Tree< Key, T, Cmp >::size() const noexcept
+  template< typename Key, typename T, typename Cmp, bool Augmented >
+  size_t Tree< Key, T, Cmp, Augmented >::size() const noexcept
   {
     return size_;
   }
 
-  template< typename Key, typename T, typename Cmp >
-  bool Tree< Key, T, Cmp >::empty() const noexcept
+  template< typename Key, typename T, typename Cmp, bool Augmented >
+  bool Tree< Key, T, Cmp, Augmented >::empty() const noexcept
   {
     return size_ == 0;
   }
 
-  template< typename Key, typename T, typename Cmp >
-  void Tree< Key, T, Cmp >::swap(Tree< Key, T, Cmp >& rhs) noexcept
+  template< typename Key, typename T, typename Cmp, bool Augmented >
+  Cmp Tree< Key, T, Cmp, Augmented >::key_comp() const
+  {
+    return cmp_;
+  }
+
+  template< typename Key, typename T, typename Cmp, bool Augmented >
+  void Tree< Key, T, Cmp, Augmented >::swap(Tree< Key, T, Cmp, Augmented >& rhs) noexcept
   {
     std::swap(fakeRoot_, rhs.fakeRoot_);
     std::swap(root_, rhs.root_);
@@ -709,14 +785,14 @@ namespace demehin
     std::swap(size_, rhs.size_);
   }
 
-  template< typename Key, typename T, typename Cmp >
-  size_t Tree< Key, T, Cmp >::count(const Key& key) const noexcept
+  template< typename Key, typename T, typename Cmp, bool Augmented >
+  size_t Tree< Key, T, Cmp, Augmented >::count(const Key& key) const noexcept
   {
     return (find(key) != end());
   }
 
-  template< typename Key, typename T, typename Cmp >
-  typename Tree< Key, T, Cmp >::Iter Tree< Key, T, Cmp >::lower_bound(const Key& key) noexcept
+  template< typename Key, typename T, typename Cmp, bool Augmented >
+  typename Tree< Key, T, Cmp, Augmented >::Iter Tree< Key, T, Cmp, Augmented >::lower_bound(const Key& key) noexcept
   {
     Node* current = root_;
     Node* res = fakeRoot_;
@@ -735,14 +811,14 @@ namespace demehin
     return Iter(res);
   }
 
-  template< typename Key, typename T, typename Cmp >
-  typename Tree< Key, T, Cmp >::cIter Tree< Key, T, Cmp >::lower_bound(const Key& key) const noexcept
+  template< typename Key, typename T, typename Cmp, bool Augmented >
+  typename Tree< Key, T, Cmp, Augmented >::cIter Tree< Key, T, Cmp, Augmented >::lower_bound(const Key& key) const noexcept
   {
     return cIter(lower_bound(key));
   }
 
-  template< typename Key, typename T, typename Cmp >
-  typename Tree< Key, T, Cmp >::Iter Tree< Key, T, Cmp >::upper_bound(const Key& key) noexcept
+  template< typename Key, typename T, typename Cmp, bool Augmented >
+  typename Tree< Key, T, Cmp, Augmented >::Iter Tree< Key, T, Cmp, Augmented >::upper_bound(const Key& key) noexcept
   {
     Node* current = root_;
     Node* res = fakeRoot_;
@@ -761,166 +837,307 @@ namespace demehin
     return Iter(res);
   }
 
-  template< typename Key, typename T, typename Cmp >
-  typename Tree< Key, T, Cmp >::cIter Tree< Key, T, Cmp >::upper_bound(const Key& key) const noexcept
+  template< typename Key, typename T, typename Cmp, bool Augmented >
+  typename Tree< Key, T, Cmp, Augmented >::cIter Tree< Key, T, Cmp, Augmented >::upper_bound(const Key& key) const noexcept
   {
     return cIter(upper_bound(key));
   }
 
-  template< typename Key, typename T, typename Cmp >
-  typename Tree< Key, T, Cmp >::IterPair Tree< Key, T, Cmp >::equal_range(const Key& key) noexcept
+  template< typename Key, typename T, typename Cmp, bool Augmented >
+  typename Tree< Key, T, Cmp, Augmented >::IterPair Tree< Key, T, Cmp, Augmented >::equal_range(const Key& key) noexcept
   {
     return std::make_pair(lower_bound(key), upper_bound(key));
   }
 
-  template< typename Key, typename T, typename Cmp >
-  typename Tree< Key, T, Cmp >::LnrIter Tree< Key, T, Cmp >::lnrBegin() const noexcept
+  template< typename Key, typename T, typename Cmp, bool Augmented >
+  size_t Tree< Key, T, Cmp, Augmented >::rank(const Key& key) const noexcept
   {
-    auto it = LnrIter(root_);
-    while (it.node_->left != nullptr)
+    static_assert(Augmented, "rank needs an augmented tree");
+    return countBelow(key, false);
+  }
+
+  template< typename Key, typename T, typename Cmp, bool Augmented >
+  typename Tree< Key, T, Cmp, Augmented >::Iter Tree< Key, T, Cmp, Augmented >::select(size_t pos) const noexcept
+  {
+    static_assert(Augmented, "select needs an augmented tree");
+    if (pos >= size_)
     {
-      it.stack_.push(it.node_);
-      it.node_ = it.node_->left;
+      return end();
     }
-    return it;
+    Node* current = root_;
+    while (pos != subtreeSize(current->left))
+    {
+      size_t leftSize = subtreeSize(current->left);
+      if (pos < leftSize)
+      {
+        current = current->left;
+      }
+      else
+      {
+        pos -= leftSize + 1;
+        current = current->right;
+      }
+    }
+    return Iter(current);
   }
 
-  template< typename Key, typename T, typename Cmp >
-  typename Tree< Key, T, Cmp >::LnrIter Tree< Key, T, Cmp >::lnrEnd() const noexcept
+  template< typename Key, typename T, typename Cmp, bool Augmented >
+  size_t Tree< Key, T, Cmp, Augmented >::count_range(const Key& lo, const Key& hi) const noexcept
+  {
+    static_assert(Augmented, "count_range needs an augmented tree");
+    if (cmp_(hi, lo))
+    {
+      return 0;
+    }
+    return countBelow(hi, true) - countBelow(lo, false);
+  }
+
+  template< typename Key, typename T, typename Cmp, bool Augmented >
+  typename Tree< Key, T, Cmp, Augmented >::sum_t Tree< Key, T, Cmp, Augmented >::sum_range(const Key& lo, const Key& hi) const noexcept
+  {
+    static_assert(Augmented && std::is_arithmetic< Key >::value, "sum_range needs an augmented tree of numbers");
+    if (cmp_(hi, lo))
+    {
+      return sum_t();
+    }
+    return static_cast< sum_t >(sumBelow(hi, true) - sumBelow(lo, false));
+  }
+
+  template< typename Key, typename T, typename Cmp, bool Augmented >
+  typename Tree< Key, T, Cmp, Augmented >::sum_t Tree< Key, T, Cmp, Augmented >::key_sum() const noexcept
+  {
+    static_assert(Augmented && std::is_arithmetic< Key >::value, "key_sum needs an augmented tree of numbers");
+    return static_cast< sum_t >(subtreeSum(root_));
+  }
+
+  template< typename Key, typename T, typename Cmp, bool Augmented >
+  size_t Tree< Key, T, Cmp, Augmented >::countBelow(const Key& key, bool inclusive) const noexcept
+  {
+    size_t res = 0;
+    Node* current = root_;
+    while (current != fakeRoot_ && current != nullptr)
+    {
+      if (inclusive ? !cmp_(key, current->data.first) : cmp_(current->data.first, key))
+      {
+        res += subtreeSize(current->left) + 1;
+        current = current->right;
+      }
+      else
+      {
+        current = current->left;
+      }
+    }
+    return res;
+  }
+
+  template< typename Key, typename T, typename Cmp, bool Augmented >
+  typename Tree< Key, T, Cmp, Augmented >::acc_t Tree< Key, T, Cmp, Augmented >::sumBelow(const Key& key, bool inclusive) const noexcept
+  {
+    acc_t res = acc_t();
+    Node* current = root_;
+    while (current != fakeRoot_ && current != nullptr)
+    {
+      if (inclusive ? !cmp_(key, current->data.first) : cmp_(current->data.first, key))
+      {
+        res += subtreeSum(current->left) + static_cast< acc_t >(current->data.first);
+        current = current->right;
+      }
+      else
+      {
+        current = current->left;
+      }
+    }
+    return res;
+  }
+
+  template< typename Key, typename T, typename Cmp, bool Augmented >
+  typename Tree< Key, T, Cmp, Augmented >::LnrIter Tree< Key, T, Cmp, Augmented >::lnrBegin() const noexcept
+  {
+    if (empty())
+    {
+      return lnrEnd();
+    }
+    Node* current = root_;
+    while (current->left != nullptr)
+    {
+      current = current->left;
+    }
+    return LnrIter(current);
+  }
+
+  template< typename Key, typename T, typename Cmp, bool Augmented >
+  typename Tree< Key, T, Cmp, Augmented >::LnrIter Tree< Key, T, Cmp, Augmented >::lnrEnd() const noexcept
   {
     return LnrIter(nullptr);
   }
 
-  template< typename Key, typename T, typename Cmp >
-  typename Tree< Key, T, Cmp >::cLnrIter Tree< Key, T, Cmp >::clnrBegin() const noexcept
+  template< typename Key, typename T, typename Cmp, bool Augmented >
+  typename Tree< Key, T, Cmp, Augmented >::cLnrIter Tree< Key, T, Cmp, Augmented >::clnrBegin() const noexcept
   {
-    auto it = cLnrIter(root_);
-    while (it.node_->left != nullptr)
+    if (empty())
+    {
+      return clnrEnd();
+    }
+    Node* current = root_;
+    while (current->left != nullptr)
     {
-      it.stack_.push(it.node_);
-      it.node_ = it.node_->left;
+      current = current->left;
     }
-    return it;
+    return cLnrIter(current);
   }
 
-  template< typename Key, typename T, typename Cmp >
-  typename Tree< Key, T, Cmp >::cLnrIter Tree< Key, T, Cmp >::clnrEnd() const noexcept
+  template< typename Key, typename T, typename Cmp, bool Augmented >
+  typename Tree< Key, T, Cmp, Augmented >::cLnrIter Tree< Key, T, Cmp, Augmented >::clnrEnd() const noexcept
   {
     return cLnrIter(nullptr);
   }
 
-  template< typename Key, typename T, typename Cmp >
-  typename Tree< Key, T, Cmp >::RnlIter Tree< Key, T, Cmp >::rnlBegin() const noexcept
+  template< typename Key, typename T, typename Cmp, bool Augmented >
+  typename Tree< Key, T, Cmp, Augmented >::RnlIter Tree< Key, T, Cmp, Augmented >::rnlBegin() const noexcept
   {
-    auto it = RnlIter(root_);
-    while (it.node_->right != nullptr)
+    if (empty())
+    {
+      return rnlEnd();
+    }
+    Node* current = root_;
+    while (current->right != nullptr)
     {
-      it.stack_.push(it.node_);
-      it.node_ = it.node_->right;
+      current = current->right;
     }
-    return it;
+    return RnlIter(current);
   }
 
-  template< typename Key, typename T, typename Cmp >
-  typename Tree< Key, T, Cmp >::RnlIter Tree< Key, T, Cmp >::rnlEnd() const noexcept
+  template< typename Key, typename T, typename Cmp, bool Augmented >
+  typename Tree< Key, T, Cmp, Augmented >::RnlIter Tree< Key, T, Cmp, Augmented >::rnlEnd() const noexcept
   {
     return RnlIter(nullptr);
   }
 
-  template< typename Key, typename T, typename Cmp >
-  typename Tree< Key, T, Cmp >::cRnlIter Tree< Key, T, Cmp >::crnlBegin() const noexcept
+  template< typename Key, typename T, typename Cmp, bool Augmented >
+  typename Tree< Key, T, Cmp, Augmented >::cRnlIter Tree< Key, T, Cmp, Augmented >::crnlBegin() const noexcept
   {
-    auto it = cRnlIter(root_);
-    while (it.node_->right != nullptr)
+    if (empty())
     {
-      it.stack_.push(it.node_);
-      it.node_ = it.node_->right;
+      return crnlEnd();
     }
-    return it;
+    Node* current = root_;
+    while (current->right != nullptr)
+    {
+      current = current->right;
+    }
+    return cRnlIter(current);
   }
 
-  template< typename Key, typename T, typename Cmp >
-  typename Tree< Key, T, Cmp >::cRnlIter Tree< Key, T, Cmp >::crnlEnd() const noexcept
+  template< typename Key, typename T, typename Cmp, bool Augmented >
+  typename Tree< Key, T, Cmp, Augmented >::cRnlIter Tree< Key, T, Cmp, Augmented >::crnlEnd() const noexcept
   {
     return cRnlIter(nullptr);
   }
 
-  template< typename Key, typename T, typename Cmp >
-  typename Tree< Key, T, Cmp >::BrIter Tree< Key, T, Cmp >::brBegin() const noexcept
+  template< typename Key, typename T, typename Cmp, bool Augmented >
+  typename Tree< Key, T, Cmp, Augmented >::BrIter Tree< Key, T, Cmp, Augmented >::brBegin() const noexcept
   {
     return BrIter(root_);
   }
 
-  template< typename Key, typename T, typename Cmp >
-  typename Tree< Key, T, Cmp >::BrIter Tree< Key, T, Cmp >::brEnd() const noexcept
+  template< typename Key, typename T, typename Cmp, bool Augmented >
+  typename Tree< Key, T, Cmp, Augmented >::BrIter Tree< Key, T, Cmp, Augmented >::brEnd() const noexcept
   {
     return BrIter(nullptr);
   }
 
-  template< typename Key, typename T, typename Cmp >
-  typename Tree< Key, T, Cmp >::cBrIter Tree< Key, T, Cmp >::cbrBegin() const noexcept
+  template< typename Key, typename T, typename Cmp, bool Augmented >
+  typename Tree< Key, T, Cmp, Augmented >::cBrIter Tree< Key, T, Cmp, Augmented >::cbrBegin() const noexcept
   {
     return cBrIter(root_);
   }
 
-  template< typename Key, typename T, typename Cmp >
-  typename Tree< Key, T, Cmp >::cBrIter Tree< Key, T, Cmp >::cbrEnd() const noexcept
+  template< typename Key, typename T, typename Cmp, bool Augmented >
+  typename Tree< Key, T, Cmp, Augmented >::cBrIter Tree< Key, T, Cmp, Augmented >::cbrEnd() const noexcept
   {
     return cBrIter(nullptr);
   }
 
-  template< typename Key, typename T, typename Cmp >
+  template< typename Key, typename T, typename Cmp, bool Augmented >
   template< typename F >
-  F Tree< Key, T, Cmp >::traverse_lnr(F f) const
+  F Tree< Key, T, Cmp, Augmented >::traverse_lnr(F f) const
   {
     return traverse(f, lnrBegin(), lnrEnd());
   }
 
-  template< typename Key, typename T, typename Cmp >
+  template< typename Key, typename T, typename Cmp, bool Augmented >
   template< typename F >
-  F Tree< Key, T, Cmp >::const_traverse_lnr(F f) const
+  F Tree< Key, T, Cmp, Augmented >::const_traverse_lnr(F f) const
   {
     return traverse(f, clnrBegin(), clnrEnd());
   }
 
-  template< typename Key, typename T, typename Cmp >
+  template< typename Key, typename T, typename Cmp, bool Augmented >
   template< typename F >
-  F Tree< Key, T, Cmp >::traverse_rnl(F f) const
+  F Tree< Key, T, Cmp, Augmented >::traverse_rnl(F f) const
   {
     return traverse(f, rnlBegin(), rnlEnd());
   }
 
-  template< typename Key, typename T, typename Cmp >
+  template< typename Key, typename T, typename Cmp, bool Augmented >
   template< typename F >
-  F Tree< Key, T, Cmp >::const_traverse_rnl(F f) const
+  F Tree< Key, T, Cmp, Augmented >::const_traverse_rnl(F f) const
   {
     return traverse(f, crnlBegin(), crnlEnd());
   }
 
-  template< typename Key, typename T, typename Cmp >
+  template< typename Key, typename T, typename Cmp, bool Augmented >
   template< typename F >
-  F Tree< Key, T, Cmp >::traverse_breadth(F f) const
+  F Tree< Key, T, Cmp, Augmented >::traverse_breadth(F f) const
   {
-    return traverse(f, brBegin(), brEnd());
+    return traverseLevels< Node >(f);
   }
 
-  template< typename Key, typename T, typename Cmp >
+  template< typename Key, typename T, typename Cmp, bool Augmented >
   template< typename F >
-  F Tree< Key, T, Cmp >::const_traverse_breadth(F f) const
+  F Tree< Key, T, Cmp, Augmented >::const_traverse_breadth(F f) const
   {
-    return traverse(f, cbrBegin(), cbrEnd());
+    return traverseLevels< const Node >(f);
   }
 
-  template< typename Key, typename T, typename Cmp >
+  template< typename Key, typename T, typename Cmp, bool Augmented >
   template< typename Iterator, typename F >
-  F Tree< Key, T, Cmp >::traverse(F f, Iterator begin, Iterator end) const
+  F Tree< Key, T, Cmp, Augmented >::traverse(F f, Iterator begin, Iterator end) const
   {
-    for (auto it = begin; it != end; it++)
+    for (auto it = begin; it != end; ++it)
     {
       f(*it);
     }
     return f;
   }
+
+  template< typename Key, typename T, typename Cmp, bool Augmented >
+  template< typename NodeT, typename F >
+  F Tree< Key, T, Cmp, Augmented >::traverseLevels(F f) const
+  {
+    if (empty())
+    {
+      return f;
+    }
+    Queue< NodeT* > queue;
+    queue.reserve(size_);
+    queue.push(root_);
+    while (!queue.empty())
+    {
+      NodeT* node = queue.front();
+      queue.pop();
+      f(node->data);
+      if (node->left != nullptr)
+      {
+        queue.push(node->left);
+      }
+      if (node->right != nullptr)
+      {
+        queue.push(node->right);
+      }
+    }
+    return f;
+  }
 }
 
 #endif
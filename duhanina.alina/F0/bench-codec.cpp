@@ -0,0 +1,59 @@
+#include <bench.hpp>
+#include <sstream>
+#include <string>
+#include "bitCodec.hpp"
+
+namespace
+{
+  duhanina::CodeTable make_table()
+  {
+    const char* codes[] = { "0", "10", "110", "1110", "11110", "111110", "1111110", "1111111" };
+    duhanina::CodeTable table;
+    for (size_t i = 0; i < 8; i++)
+    {
+      table.char_to_code[static_cast< char >('a' + i)] = codes[i];
+    }
+    return table;
+  }
+
+  std::string make_text(size_t size)
+  {
+    std::string text;
+    text.reserve(size);
+    unsigned long long seed = 20250101;
+    for (size_t i = 0; i < size; i++)
+    {
+      seed = seed * 6364136223846793005ULL + 1442695040888963407ULL;
+      unsigned long long bits = seed >> 33;
+      size_t symbol = 0;
+      while (symbol < 7 && (bits & 1))
+      {
+        bits >>= 1;
+        symbol++;
+      }
+      text += static_cast< char >('a' + symbol);
+    }
+    return text;
+  }
+
+  void run_codec(const char* name, const bench::Options& opts)
+  {
+    duhanina::BitCodec codec(make_table());
+    std::string text = make_text(opts.n * 10);
+
+    std::istringstream plain(text);
+    std::stringstream encoded;
+    bench::Probe encode(name, "encode");
+    duhanina::CodecStats stats = codec.encode(plain, encoded);
+    encode.stop(stats.original_bytes);
+    bench::keep(stats.encoded_bits);
+
+    std::ostringstream decoded;
+    bench::Probe decode(name, "decode");
+    stats = codec.decode(encoded, decoded);
+    decode.stop(stats.original_bytes);
+    bench::keep(decoded.str().size() == text.size());
+  }
+
+  const bench::Registrar codec("duhanina::BitCodec", run_codec);
+}
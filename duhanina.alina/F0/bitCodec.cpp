@@ -0,0 +1,347 @@
+#include "bitCodec.hpp"
+#include <istream>
+#include <memory>
+#include <ostream>
+#include <stdexcept>
+
+namespace
+{
+  constexpr size_t header_size = sizeof(uint64_t);
+
+  void write_count(std::ostream& out, uint64_t count)
+  {
+    char header[header_size];
+    for (size_t i = 0; i < header_size; i++)
+    {
+      header[i] = static_cast< char >(static_cast< unsigned char >(count >> (8 * i)));
+    }
+    out.write(header, header_size);
+  }
+
+  uint64_t read_count(std::istream& in)
+  {
+    char header[header_size];
+    if (!in.read(header, header_size))
+    {
+      throw std::runtime_error("INVALID_HEADER");
+    }
+    uint64_t count = 0;
+    for (size_t i = 0; i < header_size; i++)
+    {
+      count |= static_cast< uint64_t >(static_cast< unsigned char >(header[i])) << (8 * i);
+    }
+    return count;
+  }
+
+  class BlockWriter
+  {
+  public:
+    explicit BlockWriter(std::ostream& out):
+      out_(out),
+      block_(new char[duhanina::BitCodec::block_size]),
+      used_(0)
+    {}
+
+    void put(char byte)
+    {
+      block_[used_++] = byte;
+      if (used_ == duhanina::BitCodec::block_size)
+      {
+        flush();
+      }
+    }
+
+    void flush()
+    {
+      if (!out_.write(block_.get(), used_))
+      {
+        throw std::runtime_error("INVALID_FILE");
+      }
+      used_ = 0;
+    }
+
+  private:
+    std::ostream& out_;
+    std::unique_ptr< char[] > block_;
+    size_t used_;
+  };
+
+  class BitWriter
+  {
+  public:
+    explicit BitWriter(std::ostream& out):
+      bytes_(out),
+      buffer_(0),
+      used_(0),
+      total_(0)
+    {}
+
+    void put(uint64_t code, size_t length)
+    {
+      total_ += length;
+      if (used_ + length > 64)
+      {
+        size_t head = 64 - used_;
+        length -= head;
+        buffer_ |= code >> length;
+        flush_word(8);
+        code &= (uint64_t(1) << length) - 1;
+      }
+      buffer_ |= code << (64 - used_ - length);
+      used_ += length;
+      if (used_ == 64)
+      {
+        flush_word(8);
+      }
+    }
+
+    void finish()
+    {
+      flush_word((used_ + 7) / 8);
+      bytes_.flush();
+    }
+
+    size_t bits() const noexcept
+    {
+      return total_;
+    }
+
+  private:
+    BlockWriter bytes_;
+    uint64_t buffer_;
+    size_t used_;
+    size_t total_;
+
+    void flush_word(size_t bytes)
+    {
+      for (size_t i = 0; i < bytes; i++)
+      {
+        bytes_.put(static_cast< char >(static_cast< unsigned char >(buffer_ >> (56 - 8 * i))));
+      }
+      buffer_ = 0;
+      used_ = 0;
+    }
+  };
+
+  class BitReader
+  {
+  public:
+    BitReader(std::istream& in, size_t bit_count):
+      in_(in),
+      block_(new char[duhanina::BitCodec::block_size]),
+      block_length_(0),
+      block_pos_(0),
+      buffer_(0),
+      available_(0),
+      bytes_left_((bit_count + 7) / 8),
+      bits_left_(bit_count)
+    {}
+
+    void refill()
+    {
+      while (available_ <= 56 && bytes_left_ > 0)
+      {
+        if (block_pos_ == block_length_)
+        {
+          size_t request = bytes_left_ < duhanina::BitCodec::block_size ? bytes_left_ : duhanina::BitCodec::block_size;
+          in_.read(block_.get(), request);
+          block_length_ = in_.gcount();
+          block_pos_ = 0;
+          if (block_length_ == 0)
+          {
+            throw std::runtime_error("TRUNCATED_FILE");
+          }
+        }
+        buffer_ |= static_cast< uint64_t >(static_cast< unsigned char >(block_[block_pos_++])) << (56 - available_);
+        available_ += 8;
+        bytes_left_--;
+      }
+    }
+
+    uint64_t peek() const noexcept
+    {
+      return buffer_;
+    }
+
+    void consume(size_t count) noexcept
+    {
+      buffer_ = count == 64 ? 0 : buffer_ << count;
+      available_ -= count;
+      bits_left_ -= count;
+    }
+
+    size_t remaining() const noexcept
+    {
+      return bits_left_;
+    }
+
+  private:
+    std::istream& in_;
+    std::unique_ptr< char[] > block_;
+    size_t block_length_;
+    size_t block_pos_;
+    uint64_t buffer_;
+    size_t available_;
+    size_t bytes_left_;
+    size_t bits_left_;
+  };
+}
+
+duhanina::BitCodec::BitCodec(const CodeTable& table):
+  codes_(),
+  lengths_(),
+  nodes_(),
+  lookup_()
+{
+  nodes_.push_back(DecodeNode{ { -1, -1 }, -1 });
+  for (auto it = table.char_to_code.cbegin(); it != table.char_to_code.cend(); ++it)
+  {
+    add_code(static_cast< unsigned char >(it->first), it->second);
+  }
+  build_lookup();
+}
+
+void duhanina::BitCodec::add_code(unsigned char symbol, const std::string& code)
+{
+  if (code.empty() || code.size() > max_code_length || lengths_[symbol] != 0)
+  {
+    throw std::runtime_error("INVALID_CODES");
+  }
+  uint64_t bits = 0;
+  int node = 0;
+  for (size_t i = 0; i < code.size(); i++)
+  {
+    if ((code[i] != '0' && code[i] != '1') || nodes_[node].symbol >= 0)
+    {
+      throw std::runtime_error("INVALID_CODES");
+    }
+    int bit = code[i] - '0';
+    bits = (bits << 1) | static_cast< uint64_t >(bit);
+    if (nodes_[node].child[bit] < 0)
+    {
+      nodes_.push_back(DecodeNode{ { -1, -1 }, -1 });
+      nodes_[node].child[bit] = static_cast< int >(nodes_.size() - 1);
+    }
+    node = nodes_[node].child[bit];
+  }
+  if (nodes_[node].symbol >= 0 || nodes_[node].child[0] >= 0 || nodes_[node].child[1] >= 0)
+  {
+    throw std::runtime_error("INVALID_CODES");
+  }
+  nodes_[node].symbol = symbol;
+  codes_[symbol] = bits;
+  lengths_[symbol] = static_cast< unsigned char >(code.size());
+}
+
+void duhanina::BitCodec::build_lookup()
+{
+  for (size_t prefix = 0; prefix < (size_t(1) << lookup_bits); prefix++)
+  {
+    LookupEntry entry{ 0, static_cast< unsigned char >(lookup_bits), false };
+    for (size_t i = 0; i < lookup_bits; i++)
+    {
+      int next = nodes_[entry.target].child[(prefix >> (lookup_bits - 1 - i)) & 1];
+      if (next < 0)
+      {
+        entry = LookupEntry{ -1, 0, false };
+        break;
+      }
+      entry.target = next;
+      if (nodes_[next].symbol >= 0)
+      {
+        entry = LookupEntry{ nodes_[next].symbol, static_cast< unsigned char >(i + 1), true };
+        break;
+      }
+    }
+    lookup_[prefix] = entry;
+  }
+}
+
+size_t duhanina::BitCodec::encoded_bits(const char* data, size_t size) const
+{
+  size_t bits = 0;
+  for (size_t i = 0; i < size; i++)
+  {
+    unsigned char symbol = static_cast< unsigned char >(data[i]);
+    if (lengths_[symbol] == 0)
+    {
+      throw std::runtime_error("INVALID_CODES");
+    }
+    bits += lengths_[symbol];
+  }
+  return bits;
+}
+
+duhanina::CodecStats duhanina::BitCodec::encode(std::istream& in, std::ostream& out) const
+{
+  CodecStats stats;
+  std::streampos header = out.tellp();
+  write_count(out, 0);
+  BitWriter writer(out);
+  std::unique_ptr< char[] > block(new char[block_size]);
+  while (in.read(block.get(), block_size) || in.gcount() > 0)
+  {
+    size_t count = in.gcount();
+    for (size_t i = 0; i < count; i++)
+    {
+      unsigned char symbol = static_cast< unsigned char >(block[i]);
+      if (lengths_[symbol] == 0)
+      {
+        throw std::runtime_error("INVALID_CODES");
+      }
+      writer.put(codes_[symbol], lengths_[symbol]);
+    }
+    stats.original_bytes += count;
+  }
+  writer.finish();
+  stats.encoded_bits = writer.bits();
+  out.seekp(header);
+  write_count(out, stats.encoded_bits);
+  out.seekp(0, std::ios::end);
+  if (!out)
+  {
+    throw std::runtime_error("INVALID_FILE");
+  }
+  return stats;
+}
+
+duhanina::CodecStats duhanina::BitCodec::decode(std::istream& in, std::ostream& out) const
+{
+  CodecStats stats;
+  stats.encoded_bits = read_count(in);
+  BitReader reader(in, stats.encoded_bits);
+  BlockWriter writer(out);
+  while (reader.remaining() != 0)
+  {
+    reader.refill();
+    const LookupEntry& entry = lookup_[reader.peek() >> (64 - lookup_bits)];
+    if (entry.target < 0 || entry.length > reader.remaining())
+    {
+      throw std::runtime_error("INVALID_CODES");
+    }
+    reader.consume(entry.length);
+    int node = entry.target;
+    if (!entry.is_leaf)
+    {
+      while (nodes_[node].symbol < 0)
+      {
+        if (reader.remaining() == 0)
+        {
+          throw std::runtime_error("INVALID_CODES");
+        }
+        reader.refill();
+        node = nodes_[node].child[reader.peek() >> 63];
+        reader.consume(1);
+        if (node < 0)
+        {
+          throw std::runtime_error("INVALID_CODES");
+        }
+      }
+      node = nodes_[node].symbol;
+    }
+    writer.put(static_cast< char >(static_cast< unsigned char >(node)));
+    stats.original_bytes++;
+  }
+  writer.flush();
+  return stats;
+}
@@ -0,0 +1,54 @@
+#ifndef BITCODEC_HPP
+#define BITCODEC_HPP
+
+#include <cstdint>
+#include <iosfwd>
+#include <array.hpp>
+#include "shannonFano.hpp"
+
+namespace duhanina
+{
+  struct CodecStats
+  {
+    size_t original_bytes = 0;
+    size_t encoded_bits = 0;
+  };
+
+  class BitCodec
+  {
+  public:
+    static constexpr size_t block_size = 1 << 16;
+    static constexpr size_t lookup_bits = 10;
+    static constexpr size_t max_code_length = 64;
+
+    explicit BitCodec(const CodeTable& table);
+
+    size_t encoded_bits(const char* data, size_t size) const;
+    CodecStats encode(std::istream& in, std::ostream& out) const;
+    CodecStats decode(std::istream& in, std::ostream& out) const;
+
+  private:
+    struct DecodeNode
+    {
+      int child[2];
+      int symbol;
+    };
+
+    struct LookupEntry
+    {
+      int target;
+      unsigned char length;
+      bool is_leaf;
+    };
+
+    uint64_t codes_[256];
+    unsigned char lengths_[256];
+    DynamicArray< DecodeNode > nodes_;
+    LookupEntry lookup_[1 << lookup_bits];
+
+    void add_code(unsigned char symbol, const std::string& code);
+    void build_lookup();
+  };
+}
+
+#endif
@@ -0,0 +1,133 @@
+#include "histogram.hpp"
+#include <fstream>
+#include <future>
+#include <memory>
+#include <stdexcept>
+#include <thread>
+
+namespace
+{
+  constexpr size_t block_size = 1 << 16;
+  constexpr size_t min_chunk_size = 1 << 20;
+
+  size_t configured_threads = 0;
+
+  size_t count_block(std::istream& in, size_t limit, char* block, duhanina::Histogram& result)
+  {
+    in.read(block, limit);
+    size_t count = in.gcount();
+    const unsigned char* bytes = reinterpret_cast< const unsigned char* >(block);
+    for (size_t i = 0; i < count; i++)
+    {
+      result.counts[bytes[i]]++;
+    }
+    result.total += count;
+    return count;
+  }
+
+  duhanina::Histogram count_stream(std::istream& in)
+  {
+    duhanina::Histogram result;
+    std::unique_ptr< char[] > block(new char[block_size]);
+    size_t count = 0;
+    do
+    {
+      count = count_block(in, block_size, block.get(), result);
+    }
+    while (count != 0);
+    if (in.bad())
+    {
+      throw std::runtime_error("READ_ERROR");
+    }
+    return result;
+  }
+
+  duhanina::Histogram count_range(const std::string& input_file, size_t begin, size_t length)
+  {
+    std::ifstream in(input_file, std::ios::binary);
+    if (!in || !in.seekg(begin))
+    {
+      throw std::runtime_error("FILE_NOT_FOUND");
+    }
+    duhanina::Histogram result;
+    std::unique_ptr< char[] > block(new char[block_size]);
+    while (length > 0)
+    {
+      size_t count = count_block(in, length < block_size ? length : block_size, block.get(), result);
+      if (count == 0)
+      {
+        throw std::runtime_error("READ_ERROR");
+      }
+      length -= count;
+    }
+    return result;
+  }
+}
+
+void duhanina::Histogram::merge(const Histogram& other) noexcept
+{
+  for (size_t i = 0; i < 256; i++)
+  {
+    counts[i] += other.counts[i];
+  }
+  total += other.total;
+}
+
+void duhanina::set_histogram_threads(size_t threads) noexcept
+{
+  configured_threads = threads;
+}
+
+size_t duhanina::histogram_threads() noexcept
+{
+  if (configured_threads != 0)
+  {
+    return configured_threads;
+  }
+  size_t threads = std::thread::hardware_concurrency();
+  return threads == 0 ? 1 : threads;
+}
+
+duhanina::Histogram duhanina::count_symbols(const std::string& input_file)
+{
+  return count_symbols(input_file, histogram_threads());
+}
+
+duhanina::Histogram duhanina::count_symbols(const std::string& input_file, size_t threads)
+{
+  std::ifstream in(input_file, std::ios::binary);
+  if (!in)
+  {
+    throw std::runtime_error("FILE_NOT_FOUND");
+  }
+  std::streamoff end = in.seekg(0, std::ios::end) ? static_cast< std::streamoff >(in.tellg()) : -1;
+  if (end < 0)
+  {
+    in.clear();
+    return count_stream(in);
+  }
+  size_t size = static_cast< size_t >(end);
+  size_t max_threads = size / min_chunk_size;
+  if (threads > max_threads)
+  {
+    threads = max_threads;
+  }
+  if (threads <= 1)
+  {
+    return count_range(input_file, 0, size);
+  }
+  size_t chunk = (size + threads - 1) / threads;
+  std::unique_ptr< std::future< Histogram >[] > parts(new std::future< Histogram >[threads - 1]);
+  for (size_t i = 1; i < threads; i++)
+  {
+    size_t begin = i * chunk;
+    size_t length = begin + chunk < size ? chunk : size - begin;
+    parts[i - 1] = std::async(std::launch::async, count_range, std::cref(input_file), begin, length);
+  }
+  Histogram result = count_range(input_file, 0, chunk);
+  for (size_t i = 0; i < threads - 1; i++)
+  {
+    result.merge(parts[i].get());
+  }
+  return result;
+}
@@ -0,0 +1,23 @@
+#ifndef HISTOGRAM_HPP
+#define HISTOGRAM_HPP
+
+#include <cstddef>
+#include <string>
+
+namespace duhanina
+{
+  struct Histogram
+  {
+    size_t counts[256] = {};
+    size_t total = 0;
+
+    void merge(const Histogram& other) noexcept;
+  };
+
+  void set_histogram_threads(size_t threads) noexcept;
+  size_t histogram_threads() noexcept;
+  Histogram count_symbols(const std::string& input_file);
+  Histogram count_symbols(const std::string& input_file, size_t threads);
+}
+
+#endif
@@ -3,8 +3,9 @@
 #include <iomanip>
 #include <cmath>
 #include <algorithm>
-#include <list.hpp>
-#include <array.hpp>
+#include <limits>
+#include "bitCodec.hpp"
+#include "histogram.hpp"
 
 namespace
 {
@@ -25,279 +26,71 @@ namespace
     }
   }
 
-  void build_shannon_fano_codes(duhanina::NodeSymb* node, std::string code, duhanina::Tree< char, std::string, std::less< char > >& codes)
-  {
-    if (!node)
-    {
-      return;
-    }
-    if (node->left == nullptr && node->right == nullptr)
-    {
-      codes[node->symbol] = code;
-      return;
-    }
-    if (node->left != nullptr)
-    {
-      build_shannon_fano_codes(node->left, code + "0", codes);
-    }
-    if (node->right != nullptr)
-    {
-      build_shannon_fano_codes(node->right, code + "1", codes);
-    }
-  }
+  using symbol_freq = std::pair< char, size_t >;
 
-  void delete_tree(duhanina::NodeSymb* node)
+  size_t distance(size_t lhs, size_t rhs)
   {
-    if (node != nullptr)
-    {
-      delete_tree(node->left);
-      delete_tree(node->right);
-      delete node;
-    }
+    return lhs > rhs ? lhs - rhs : rhs - lhs;
   }
 
-  duhanina::NodeSymb* build_subtree(const duhanina::DynamicArray< duhanina::NodeSymb* >& nodes, size_t start, size_t end)
+  void assign_codes(const symbol_freq* symbols, size_t count, const std::string& code, duhanina::CodeTable& table)
   {
-    if (start >= end || nodes.empty() || start >= nodes.size())
-    {
-      return nullptr;
-    }
-    duhanina::NodeSymb* subtree = nodes[start];
-    for (size_t i = start + 1; i < end; i++)
+    if (count == 1)
     {
-      duhanina::NodeSymb* new_node = nullptr;
-      try
-      {
-        new_node = new duhanina::NodeSymb(subtree->freq + nodes[i]->freq, subtree, nodes[i]);
-      }
-      catch (...)
-      {
-        delete_tree(subtree);
-        throw std::runtime_error("Error memory");
-      }
-      subtree = new_node;
+      table.char_to_code[symbols[0].first] = code;
+      return;
     }
-    return subtree;
-  }
-
-  std::pair< duhanina::NodeSymb*, duhanina::NodeSymb* > split_nodes(const duhanina::DynamicArray< duhanina::NodeSymb* >& nodes)
-  {
     size_t total = 0;
-    for (size_t i = 0; i < nodes.size(); ++i)
+    for (size_t i = 0; i < count; i++)
     {
-      total += nodes[i]->freq;
+      total += symbols[i].second;
     }
-    size_t sum = 0;
-    size_t split_pos = 0;
-    for (; split_pos < nodes.size(); split_pos++)
+    size_t left = 0;
+    size_t split = 0;
+    while (split + 1 < count)
     {
-      sum += nodes[split_pos]->freq;
-      if (sum >= total / 2)
+      size_t next = left + symbols[split].second;
+      if (split > 0 && distance(next * 2, total) >= distance(left * 2, total))
       {
         break;
       }
+      left = next;
+      split++;
     }
-    duhanina::NodeSymb* left = build_subtree(nodes, 0, split_pos);
-    duhanina::NodeSymb* right = build_subtree(nodes, split_pos + 1, nodes.size());
-    return { left, right };
+    assign_codes(symbols, split, code + "0", table);
+    assign_codes(symbols + split, count - split, code + "1", table);
   }
 
-  duhanina::DynamicArray< duhanina::NodeSymb* > merge_nodes(duhanina::NodeSymb* left, duhanina::NodeSymb* right)
+  duhanina::CodeTable build_code_table(const size_t* freqs, size_t total_chars)
   {
-    duhanina::DynamicArray< duhanina::NodeSymb* > new_nodes;
-    if (left)
-    {
-      new_nodes.push_back(left);
-    }
-    if (right)
-    {
-      new_nodes.push_back(right);
-    }
-    return new_nodes;
-  }
-
-  duhanina::CodeTable build_code_table(str_t text)
-  {
-    if (text.empty())
+    if (total_chars == 0)
     {
       throw std::runtime_error("EMPTY");
     }
-    duhanina::Tree< char, size_t, std::less< char > > freq_map;
-    for (size_t i = 0; i < text.size(); i++)
-    {
-      char c = text[i];
-      freq_map[c]++;
-    }
-    if (freq_map.size() == 1)
+    symbol_freq symbols[256];
+    size_t count = 0;
+    for (int c = std::numeric_limits< char >::min(); c <= std::numeric_limits< char >::max(); c++)
     {
-      throw std::runtime_error("SINGLE_SYMBOL");
-    }
-    duhanina::DynamicArray< std::pair< char, size_t > > sorted_freq;
-    for (auto it = freq_map.begin(); it != freq_map.end(); ++it)
-    {
-      sorted_freq.push_back(*it);
-    }
-    for (size_t i = 0; i < sorted_freq.size(); i++)
-    {
-      for (size_t j = i + 1; j < sorted_freq.size(); j++)
+      size_t freq = freqs[static_cast< unsigned char >(c)];
+      if (freq != 0)
       {
-        if (sorted_freq[i].second < sorted_freq[j].second)
-        {
-          std::swap(sorted_freq[i], sorted_freq[j]);
-        }
+        symbols[count++] = { static_cast< char >(c), freq };
       }
     }
-    duhanina::DynamicArray< duhanina::NodeSymb* > nodes;
-    try
+    if (count == 1)
     {
-      for (size_t i = 0; i < sorted_freq.size(); i++)
-      {
-        char ch = sorted_freq[i].first;
-        size_t freq = sorted_freq[i].second;
-        nodes.push_back(new duhanina::NodeSymb(ch, freq));
-      }
-    }
-    catch (...)
-    {
-      for (size_t i = 0; i < nodes.size(); i++)
-      {
-        delete nodes[i];
-        nodes[i] = nullptr;
-      }
-      throw std::runtime_error("Error memory");
+      throw std::runtime_error("SINGLE_SYMBOL");
     }
-    while (nodes.size() > 1)
+    std::stable_sort(symbols, symbols + count, [](const symbol_freq& lhs, const symbol_freq& rhs)
     {
-      auto node_pair = split_nodes(nodes);
-      nodes = merge_nodes(node_pair.first, node_pair.second);
-    }
+      return lhs.second > rhs.second;
+    });
     duhanina::CodeTable table;
-    table.total_chars = text.size();
-    build_shannon_fano_codes(nodes[0], "", table.char_to_code);
-    for (auto it = table.char_to_code.begin(); it != table.char_to_code.end(); ++it)
-    {
-      char ch = it->first;
-      std::string code = it->second;
-      table.code_to_char[code] = ch;
-    }
-    delete_tree(nodes[0]);
+    table.total_chars = total_chars;
+    assign_codes(symbols, count, "", table);
     return table;
   }
 
-  std::string encode_text(str_t text, const duhanina::CodeTable& table)
-  {
-    std::string encoded;
-    for (size_t i = 0; i < text.size(); i++)
-    {
-      char c = text[i];
-      auto it = table.char_to_code.find(c);
-      if (it == table.char_to_code.cend())
-      {
-        throw std::runtime_error("INVALID_CODES");
-      }
-      encoded += it->second;
-    }
-    return encoded;
-  }
-
-  std::string decode_text(str_t encoded, const duhanina::CodeTable& table)
-  {
-    std::string decoded;
-    std::string current_code;
-    for (size_t i = 0; i < encoded.size(); i++)
-    {
-      char bit = encoded[i];
-      current_code += bit;
-      auto it = table.code_to_char.find(current_code);
-      if (it != table.code_to_char.cend())
-      {
-        decoded += it->second;
-        current_code.clear();
-      }
-    }
-    if (!current_code.empty())
-    {
-      throw std::runtime_error("INVALID_CODES");
-    }
-    return decoded;
-  }
-
-  void write_bits_to_file(str_t bits, str_t filename)
-  {
-    std::ofstream out(filename, std::ios::binary);
-    if (!out)
-    {
-      throw std::runtime_error("INVALID_FILE");
-    }
-    size_t bit_count = bits.size();
-    for (size_t i = 0; i < sizeof(size_t); i++)
-    {
-      char byte = (bit_count >> (8 * i)) & 0xFF;
-      out.put(byte);
-    }
-    char buffer = 0;
-    size_t bit_pos = 0;
-    for (size_t i = 0; i < bits.size(); i++)
-    {
-      if (bits[i] == '1')
-      {
-        buffer |= (1 << (7 - bit_pos));
-      }
-      bit_pos++;
-      if (bit_pos == 8)
-      {
-        out.put(buffer);
-        buffer = 0;
-        bit_pos = 0;
-      }
-    }
-    if (bit_pos > 0)
-    {
-      out.put(buffer);
-    }
-  }
-
-  std::string read_bits_from_file(str_t filename)
-  {
-    std::ifstream in(filename, std::ios::binary);
-    if (!in)
-    {
-      throw std::runtime_error("FILE_NOT_FOUND");
-    }
-    size_t bit_count = 0;
-    for (size_t i = 0; i < sizeof(size_t); i++)
-    {
-      char byte;
-      if (!in.get(byte))
-      {
-        throw std::runtime_error("INVALID_HEADER");
-      }
-      bit_count |= static_cast< size_t >(static_cast< unsigned char >(byte)) << (8 * i);
-    }
-    std::string bits;
-    bits.reserve(bit_count);
-    char byte;
-    while (in.get(byte) && bits.size() < bit_count)
-    {
-      for (size_t i = 0; i < 8 && bits.size() < bit_count; i++)
-      {
-        if (byte & (1 << (7 - i)))
-        {
-          bits += '1';
-        }
-        else
-        {
-          bits += '0';
-        }
-      }
-    }
-    if (bits.size() != bit_count)
-    {
-      throw std::runtime_error("TRUNCATED_FILE");
-    }
-    return bits;
-  }
-
   void save_code_table(const duhanina::CodeTable& table, str_t filename)
   {
     std::ofstream out(filename);
@@ -337,28 +130,26 @@ namespace
       int char_code = std::stoi(line.substr(0, space_pos));
       std::string code = line.substr(space_pos + 1);
       table.char_to_code[static_cast< char >(char_code)] = code;
-      table.code_to_char[code] = static_cast< char >(char_code);
     }
     return table;
   }
 
   void encode_file_impl(str_t input_file, str_t output_file, const duhanina::CodeTable& table, std::ostream& out)
   {
-    std::ifstream in(input_file);
+    duhanina::BitCodec codec(table);
+    std::ifstream in(input_file, std::ios::binary);
     if (!in)
     {
       throw std::runtime_error("FILE_NOT_FOUND");
     }
-    std::string text;
-    char ch;
-    while (in.get(ch))
+    std::ofstream out_file(output_file, std::ios::binary);
+    if (!out_file)
     {
-      text += ch;
+      throw std::runtime_error("INVALID_FILE");
     }
-    std::string encoded = encode_text(text, table);
-    write_bits_to_file(encoded, output_file);
-    double original_size = text.size();
-    double compressed_size = std::ceil(encoded.size() / 8.0) + sizeof(size_t);
+    duhanina::CodecStats stats = codec.encode(in, out_file);
+    double original_size = stats.original_bytes;
+    double compressed_size = std::ceil(stats.encoded_bits / 8.0) + sizeof(size_t);
     double ratio = (compressed_size / original_size) * 100;
     out << "File successfully compressed:\n";
     out << "Original size: " << original_size << " bytes\n";
@@ -368,48 +159,55 @@ namespace
 
   void decode_file_impl(str_t input_file, str_t output_file, const duhanina::CodeTable& table, std::ostream& out)
   {
-    std::string encoded = read_bits_from_file(input_file);
-    std::string decoded = decode_text(encoded, table);
-    std::ofstream out_file(output_file);
+    duhanina::BitCodec codec(table);
+    std::ifstream in(input_file, std::ios::binary);
+    if (!in)
+    {
+      throw std::runtime_error("FILE_NOT_FOUND");
+    }
+    std::ofstream out_file(output_file, std::ios::binary);
     if (!out_file)
     {
       throw std::runtime_error("INVALID_FILE");
     }
-    out_file << decoded;
+    codec.decode(in, out_file);
     out << "File successfully decompressed to '" << output_file << "'\n";
   }
 
-  duhanina::List< char > find_missing_chars(str_t text, const duhanina::Tree< char, std::string, std::less< char > >& char_to_code)
+  size_t count_missing(const duhanina::Histogram& histogram, const duhanina::CodeTable& table, bool* supported)
   {
-    duhanina::List< char > missing;
-    for (size_t i = 0; i < text.size(); i++)
+    for (size_t i = 0; i < 256; i++)
     {
-      char c = text[i];
-      if (char_to_code.find(c) == char_to_code.cend())
-      {
-        missing.push_back(c);
-      }
+      supported[i] = false;
+    }
+    for (auto it = table.char_to_code.cbegin(); it != table.char_to_code.cend(); ++it)
+    {
+      supported[static_cast< unsigned char >(it->first)] = true;
+    }
+    size_t missing = 0;
+    for (size_t i = 0; i < 256; i++)
+    {
+      missing += supported[i] ? 0 : histogram.counts[i];
     }
     return missing;
   }
 
-  void print_missing_chars(const duhanina::List< char >& missing, std::ostream& out)
+  void print_missing_chars(const duhanina::Histogram& histogram, const bool* supported, size_t missing, std::ostream& out)
   {
-    if (missing.empty())
+    out << "Missing characters (" << missing << "): ";
+    for (size_t i = 0; i < 256; i++)
     {
-      return;
-    }
-    out << "Missing characters (" << missing.size() << "): ";
-    for (auto it = missing.begin(); it != missing.end(); ++it)
-    {
-      char c = *it;
-      if (std::isprint(c))
+      if (supported[i] || histogram.counts[i] == 0)
+      {
+        continue;
+      }
+      if (std::isprint(static_cast< int >(i)))
       {
-        out << "'" << c << "' ";
+        out << "'" << static_cast< char >(i) << "' ";
       }
       else
       {
-        out << "[0x" << std::hex << static_cast< int >(c) << "] ";
+        out << "[0x" << std::hex << i << std::dec << "] ";
       }
     }
     out << "\n";
@@ -423,18 +221,8 @@ void duhanina::build_codes(str_t input_file, str_t encoding_id, std::ostream& ou
   {
     throw std::runtime_error("ID_EXISTS");
   }
-  std::ifstream in(input_file);
-  if (!in)
-  {
-    throw std::runtime_error("FILE_NOT_FOUND");
-  }
-  std::string text;
-  char ch;
-  while (in.get(ch))
-  {
-    text += ch;
-  }
-  CodeTable table = build_code_table(text);
+  Histogram histogram = count_symbols(input_file);
+  CodeTable table = build_code_table(histogram.counts, histogram.total);
   encoding_store[encoding_id] = table;
   out << "Code table successfully built and saved with ID '" << encoding_id << "'\n";
 }
@@ -576,13 +364,13 @@ void duhanina::compare(str_t file1, str_t file2, str_t encod_id1, str_t encod_id
   {
     throw std::runtime_error("IDENTICAL_TEXTS");
   }
-  std::string encoded1 = encode_text(text1, it1->second);
-  std::string encoded2 = encode_text(text2, it2->second);
+  size_t encoded1 = BitCodec(it1->second).encoded_bits(text1.data(), text1.size());
+  size_t encoded2 = BitCodec(it2->second).encoded_bits(text2.data(), text2.size());
   double size1_orig = text1.size();
-  double size1_comp = std::ceil(encoded1.size() / 8.0) + sizeof(size_t);
+  double size1_comp = std::ceil(encoded1 / 8.0) + sizeof(size_t);
   double ratio1 = size1_comp / size1_orig;
   double size2_orig = text2.size();
-  double size2_comp = std::ceil(encoded2.size() / 8.0) + sizeof(size_t);
+  double size2_comp = std::ceil(encoded2 / 8.0) + sizeof(size_t);
   double ratio2 = size2_comp / size2_orig;
   out << "Compression efficiency comparison:\n";
   out << "----------------------------------------\n";
@@ -629,6 +417,7 @@ void duhanina::print_help(std::ostream& out)
   out << "list_encodings - list all encodings\n";
   out << "check_encoding <input_file> <encoding_id> - verify if encoding supports all file characters\n";
   out << "suggest_encodings <input_file> - show which encodings best support the file\n";
+  out << "set_threads <count> - set threads used to count symbols, 0 for all hardware threads\n";
   out << "--help - show this help\n";
 }
 
@@ -639,49 +428,30 @@ void duhanina::check_encoding(str_t input_file, str_t encoding_id, std::ostream&
   {
     throw std::runtime_error("Encoding '" + encoding_id + "' not found");
   }
-  std::ifstream in(input_file);
-  if (!in)
-  {
-    throw std::runtime_error("FILE_NOT_FOUND");
-  }
-  std::string text;
-  char ch;
-  while (in.get(ch))
-  {
-    text += ch;
-  }
-  auto missing = find_missing_chars(text, it->second.char_to_code);
-  if (missing.empty())
+  Histogram histogram = count_symbols(input_file);
+  bool supported[256];
+  size_t missing = count_missing(histogram, it->second, supported);
+  if (missing == 0)
   {
     out << "Encoding fully supports the file\n";
   }
   else
   {
     out << "Encoding issues in '" << encoding_id << "':\n";
-    print_missing_chars(missing, out);
+    print_missing_chars(histogram, supported, missing, out);
   }
 }
 
 void duhanina::suggest_encodings(str_t input_file, std::ostream& out)
 {
-  std::ifstream in(input_file);
-  if (!in)
-  {
-    throw std::runtime_error("FILE_NOT_FOUND");
-  }
-  std::string text;
-  char ch;
-  while (in.get(ch))
-  {
-    text += ch;
-  }
+  Histogram histogram = count_symbols(input_file);
+  bool supported[256];
   out << "Encoding compatibility report:\n";
   for (auto encoding_it = encoding_store.begin(); encoding_it != encoding_store.end(); ++encoding_it)
   {
     str_t id = encoding_it->first;
     const CodeTable& table = encoding_it->second;
-    duhanina::List< char > missing = find_missing_chars(text, table.char_to_code);
-    if (missing.empty())
+    if (count_missing(histogram, table, supported) == 0)
     {
       out << " - " << id << ": " << "FULL" << " support\n";
     }
@@ -691,3 +461,9 @@ void duhanina::suggest_encodings(str_t input_file, std::ostream& out)
     }
   }
 }
+
+void duhanina::set_threads(size_t threads, std::ostream& out)
+{
+  set_histogram_threads(threads);
+  out << "Symbols will be counted with up to " << histogram_threads() << " threads\n";
+}
@@ -11,32 +11,9 @@ namespace duhanina
   struct CodeTable
   {
     Tree< char, std::string, std::less< char > > char_to_code;
-    Tree< std::string, char, std::less< std::string > > code_to_char;
     size_t total_chars = 0;
   };
 
-  struct NodeSymb
-  {
-    char symbol;
-    size_t freq;
-    NodeSymb* left;
-    NodeSymb* right;
-
-    NodeSymb(char s, size_t f):
-      symbol(s),
-      freq(f),
-      left(nullptr),
-      right(nullptr)
-    {}
-
-    NodeSymb(size_t f, NodeSymb* l, NodeSymb* r):
-      symbol(0),
-      freq(f),
-      left(l),
-      right(r)
-    {}
-  };
-
   using str_t = const std::string&;
 
   void print_help(std::ostream& out);
@@ -53,6 +30,7 @@ namespace duhanina
   void list_encodings(std::ostream& out);
   void check_encoding(str_t input_file, str_t encoding_id, std::ostream& out);
   void suggest_encodings(str_t input_file, std::ostream& out);
+  void set_threads(size_t threads, std::ostream& out);
 }
 
 #endif
@@ -0,0 +1,97 @@
+#include <boost/test/unit_test.hpp>
+#include <cstdio>
+#include <fstream>
+#include <iterator>
+#include <sstream>
+#include <string>
+#include "bitCodec.hpp"
+#include "shannonFano.hpp"
+
+namespace
+{
+  duhanina::CodeTable make_table()
+  {
+    duhanina::CodeTable table;
+    table.char_to_code['a'] = "0";
+    table.char_to_code['b'] = "10";
+    table.char_to_code['c'] = "110";
+    table.char_to_code['\n'] = "111";
+    return table;
+  }
+
+  std::string make_text(size_t size)
+  {
+    const char symbols[] = "aaaabbcc\n";
+    std::string text;
+    unsigned long long seed = 42;
+    for (size_t i = 0; i < size; i++)
+    {
+      seed = seed * 6364136223846793005ULL + 1442695040888963407ULL;
+      text += symbols[(seed >> 33) % (sizeof(symbols) - 1)];
+    }
+    return text;
+  }
+
+  std::string read_file(const std::string& name)
+  {
+    std::ifstream in(name, std::ios::binary);
+    return std::string(std::istreambuf_iterator< char >(in), std::istreambuf_iterator< char >());
+  }
+}
+
+BOOST_AUTO_TEST_CASE(codec_round_trip)
+{
+  duhanina::BitCodec codec(make_table());
+  std::string text = make_text(3 * duhanina::BitCodec::block_size + 17);
+
+  std::istringstream plain(text);
+  std::stringstream encoded;
+  duhanina::CodecStats encode_stats = codec.encode(plain, encoded);
+  BOOST_TEST(encode_stats.original_bytes == text.size());
+  BOOST_TEST(encode_stats.encoded_bits == codec.encoded_bits(text.data(), text.size()));
+
+  std::ostringstream decoded;
+  duhanina::CodecStats decode_stats = codec.decode(encoded, decoded);
+  BOOST_TEST(decode_stats.original_bytes == text.size());
+  BOOST_TEST((decoded.str() == text));
+
+  std::istringstream empty;
+  std::stringstream empty_encoded;
+  codec.encode(empty, empty_encoded);
+  std::ostringstream empty_decoded;
+  codec.decode(empty_encoded, empty_decoded);
+  BOOST_TEST(empty_decoded.str().empty());
+}
+
+BOOST_AUTO_TEST_CASE(file_round_trip)
+{
+  const std::string source = "test-codec-source.txt";
+  const std::string compressed = "test-codec-compressed.sfano";
+  const std::string restored = "test-codec-restored.txt";
+  const std::string restored_compressed = "test-codec-restored.sfano";
+  std::string text = make_text(100000);
+  {
+    std::ofstream out(source, std::ios::binary);
+    out << text;
+  }
+
+  std::ostringstream out;
+  duhanina::build_codes(source, "round_trip", out);
+  duhanina::encode_file(source, compressed, "round_trip", out);
+  std::rename(compressed.c_str(), restored.c_str());
+
+  std::ostringstream decode_out;
+  std::ios::fmtflags flags = decode_out.flags();
+  std::streamsize precision = decode_out.precision();
+  duhanina::decode_file(restored, restored_compressed, "round_trip", decode_out);
+  BOOST_TEST(read_file(restored_compressed) == text);
+  BOOST_TEST(decode_out.flags() == flags);
+  BOOST_TEST(decode_out.precision() == precision);
+  BOOST_TEST(out.str().find("Throughput") == std::string::npos);
+  BOOST_TEST(decode_out.str().find("Throughput") == std::string::npos);
+  duhanina::clear_codes("round_trip", out);
+
+  std::remove(source.c_str());
+  std::remove(restored.c_str());
+  std::remove(restored_compressed.c_str());
+}
@@ -0,0 +1,40 @@
+#include <boost/test/unit_test.hpp>
+#include <cstdio>
+#include <fstream>
+#include <stdexcept>
+#include <string>
+#include "histogram.hpp"
+
+BOOST_AUTO_TEST_CASE(histogram_threads_agree)
+{
+  const std::string name = "test-histogram.txt";
+  const size_t size = (7 << 20) / 2 + 12345;
+  {
+    std::ofstream out(name, std::ios::binary);
+    for (size_t i = 0; i < size; i++)
+    {
+      out.put(static_cast< char >((i * i + i / 7) % 251));
+    }
+  }
+  duhanina::Histogram single = duhanina::count_symbols(name, 1);
+  BOOST_TEST(single.total == size);
+  for (size_t threads = 2; threads <= 4; threads++)
+  {
+    duhanina::Histogram parallel = duhanina::count_symbols(name, threads);
+    BOOST_TEST(parallel.total == size);
+    for (size_t i = 0; i < 256; i++)
+    {
+      BOOST_TEST(parallel.counts[i] == single.counts[i]);
+    }
+  }
+  std::remove(name.c_str());
+  BOOST_CHECK_THROW(duhanina::count_symbols(name, 2), std::runtime_error);
+}
+
+BOOST_AUTO_TEST_CASE(histogram_threads_setting)
+{
+  duhanina::set_histogram_threads(3);
+  BOOST_TEST(duhanina::histogram_threads() == 3);
+  duhanina::set_histogram_threads(0);
+  BOOST_TEST(duhanina::histogram_threads() >= 1);
+}
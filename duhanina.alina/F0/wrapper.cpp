@@ -136,6 +136,16 @@ void duhanina::check_encoding_wrapper(std::istream& in, std::ostream& out)
   check_encoding(input_file, encoding_id, out);
 }
 
+void duhanina::set_threads_wrapper(std::istream& in, std::ostream& out)
+{
+  size_t threads = 0;
+  if (!(in >> threads))
+  {
+    throw std::runtime_error("Invalid arguments");
+  }
+  set_threads(threads, out);
+}
+
 duhanina::Tree< std::string, std::function< void() >, std::less< std::string > > duhanina::initTree(std::istream& in, std::ostream& out)
 {
   Tree< str, std::function< void() >, std::less< str > > commands;
@@ -153,5 +163,6 @@ duhanina::Tree< std::string, std::function< void() >, std::less< std::string > >
   commands["list_encodings"] = std::bind(list_encodings, std::ref(out));
   commands["suggest_encodings"] = std::bind(suggest_encodings_wrapper, std::ref(in), std::ref(out));
   commands["check_encoding"] = std::bind(check_encoding_wrapper, std::ref(in), std::ref(out));
+  commands["set_threads"] = std::bind(set_threads_wrapper, std::ref(in), std::ref(out));
   return commands;
 }
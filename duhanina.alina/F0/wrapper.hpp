@@ -21,6 +21,7 @@ namespace duhanina
   void compare_wrapper(std::istream&, std::ostream&);
   void suggest_encodings_wrapper(std::istream& in, std::ostream& out);
   void check_encoding_wrapper(std::istream& in, std::ostream& out);
+  void set_threads_wrapper(std::istream& in, std::ostream& out);
 
   Tree< str, std::function< void() >, std::less< str > > initTree(std::istream& in, std::ostream& out);
 }
@@ -0,0 +1,10 @@
+#include <bench.hpp>
+#include <HashTable.hpp>
+#include <FlatHashTable.hpp>
+
+namespace
+{
+  const bench::Registrar table("duhanina::HashTable", bench::runMap< duhanina::HashTable< int, int > >);
+  const bench::Registrar flat("duhanina::FlatHashTable", bench::runMap< duhanina::FlatHashTable< int, int > >);
+  const bench::Registrar flatChurn("duhanina::FlatHashTable<churn>", bench::runChurn< duhanina::FlatHashTable< int, int > >);
+}
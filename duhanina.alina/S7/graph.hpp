@@ -5,7 +5,7 @@
 #include <utility>
 #include <tree.hpp>
 #include <list.hpp>
-#include <HashTable.hpp>
+#include <FlatHashTable.hpp>
 
 namespace duhanina
 {
@@ -24,6 +24,7 @@ namespace duhanina
     using Weight = unsigned int;
     using Edge = std::pair< Vertex, Vertex >;
     using WeightsList = List< Weight >;
+    using EdgeTable = FlatHashTable< Edge, WeightsList, EdgeHash >;
 
     void addVertex(const Vertex& v);
     void addEdge(const Vertex& from, const Vertex& to, Weight weight);
@@ -34,10 +35,10 @@ namespace duhanina
     Tree< Vertex, WeightsList, std::less< Vertex > > getInbound(const Vertex& to) const;
     List< Vertex > getVertices() const;
     size_t vertexCount() const;
-    const HashTable< Edge, WeightsList, EdgeHash >& getAllEdges() const;
+    const EdgeTable& getAllEdges() const;
 
   private:
-    HashTable< Edge, WeightsList, EdgeHash > edges;
+    EdgeTable edges;
     Tree< Vertex, bool, std::less< Vertex > > vertices;
   };
 }
@@ -0,0 +1,153 @@
+#include <boost/test/unit_test.hpp>
+#include <string>
+#include <unordered_map>
+#include <FlatHashTable.hpp>
+
+using FlatHashTable = duhanina::FlatHashTable< int, std::string >;
+
+namespace
+{
+  template < class Group >
+  uint64_t positions(uint64_t mask)
+  {
+    uint64_t result = 0;
+    for (; mask; mask &= mask - 1)
+    {
+      result |= uint64_t(1) << Group::lowest(mask);
+    }
+    return result;
+  }
+
+  template < class Group >
+  void checkControlGroup()
+  {
+    const signed char special[] = { duhanina::details::ctrlEmpty, duhanina::details::ctrlDeleted, duhanina::details::ctrlFree };
+    unsigned long long seed = 12345;
+    for (int round = 0; round < 2000; ++round)
+    {
+      signed char ctrl[Group::width] = {};
+      for (size_t i = 0; i < Group::width; ++i)
+      {
+        seed = seed * 6364136223846793005ULL + 1442695040888963407ULL;
+        size_t kind = (seed >> 33) % 6;
+        ctrl[i] = kind < 3 ? special[kind] : static_cast< signed char >((seed >> 40) % 4);
+      }
+      Group group(ctrl);
+      uint64_t empty = 0;
+      uint64_t available = 0;
+      for (size_t i = 0; i < Group::width; ++i)
+      {
+        empty |= uint64_t(ctrl[i] == duhanina::details::ctrlEmpty) << i;
+        available |= uint64_t(ctrl[i] < duhanina::details::ctrlFree) << i;
+      }
+      BOOST_TEST(positions< Group >(group.matchEmpty()) == empty);
+      BOOST_TEST(positions< Group >(group.matchFree()) == available);
+      for (signed char fragment = 0; fragment < 4; ++fragment)
+      {
+        uint64_t expected = 0;
+        for (size_t i = 0; i < Group::width; ++i)
+        {
+          expected |= uint64_t(ctrl[i] == fragment) << i;
+        }
+        uint64_t found = positions< Group >(group.match(fragment));
+        BOOST_TEST((found & expected) == expected);
+        if (found)
+        {
+          BOOST_TEST(ctrl[Group::lowest(group.match(fragment))] == fragment);
+        }
+      }
+    }
+  }
+}
+
+BOOST_AUTO_TEST_CASE(FlatInsertAndFind)
+{
+  FlatHashTable table;
+  BOOST_TEST(table.empty());
+  BOOST_TEST((table.find(1) == table.end()));
+  auto result = table.insert({ 1, "one" });
+  BOOST_TEST(result.second);
+  BOOST_TEST(result.first->first == 1);
+  BOOST_TEST(result.first->second == "one");
+
+  auto result2 = table.emplace(1, "oneone");
+  BOOST_TEST(!result2.second);
+  BOOST_TEST(result2.first->second == "one");
+  BOOST_TEST(table.at(1) == "one");
+  BOOST_CHECK_THROW(table.at(2), std::out_of_range);
+  table[2] = "two";
+  BOOST_TEST(table.count(2) == 1);
+  BOOST_TEST(table.size() == 2);
+}
+
+BOOST_AUTO_TEST_CASE(FlatControlGroupSwar)
+{
+  checkControlGroup< duhanina::details::SwarControlGroup >();
+}
+
+#ifdef __SSE2__
+BOOST_AUTO_TEST_CASE(FlatControlGroupSse)
+{
+  checkControlGroup< duhanina::details::SseControlGroup >();
+}
+#endif
+
+BOOST_AUTO_TEST_CASE(FlatMatchesUnorderedMap)
+{
+  FlatHashTable table;
+  std::unordered_map< int, std::string > expected;
+  for (int i = 0; i < 5000; ++i)
+  {
+    int key = (i * 7919) % 2003 - 1000;
+    if (i % 3 == 2)
+    {
+      BOOST_TEST(table.erase(key) == expected.erase(key));
+    }
+    else
+    {
+      bool inserted = table.emplace(key, std::to_string(i)).second;
+      BOOST_TEST(inserted == expected.emplace(key, std::to_string(i)).second);
+    }
+  }
+  BOOST_TEST(table.size() == expected.size());
+  BOOST_TEST(table.load_factor() <= table.max_load_factor());
+  size_t visited = 0;
+  for (auto it = table.cbegin(); it != table.cend(); ++it)
+  {
+    BOOST_TEST(expected.at(it->first) == it->second);
+    ++visited;
+  }
+  BOOST_TEST(visited == expected.size());
+  for (int key = -1100; key < 1100; ++key)
+  {
+    BOOST_TEST(table.count(key) == expected.count(key));
+  }
+}
+
+BOOST_AUTO_TEST_CASE(FlatCopyAndRehash)
+{
+  FlatHashTable table;
+  for (int i = 0; i < 100; ++i)
+  {
+    table.insert({ i << 20, std::to_string(i) });
+  }
+  FlatHashTable copy(table);
+  table.erase(table.begin(), table.end());
+  BOOST_TEST(table.empty());
+  BOOST_TEST(copy.size() == 100);
+
+  copy.max_load_factor(0.5);
+  BOOST_TEST(copy.load_factor() <= 0.5);
+  copy.rehashFactor(1000);
+  for (int i = 0; i < 100; ++i)
+  {
+    BOOST_TEST(copy.at(i << 20) == std::to_string(i));
+  }
+  BOOST_CHECK_THROW(copy.max_load_factor(1.5), std::invalid_argument);
+
+  table = std::move(copy);
+  BOOST_TEST(table.size() == 100);
+  table.clear();
+  BOOST_TEST(table.empty());
+  BOOST_TEST((table.begin() == table.end()));
+}
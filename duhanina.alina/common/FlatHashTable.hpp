@@ -0,0 +1,589 @@
+#ifndef FLATHASHTABLE_HPP
+#define FLATHASHTABLE_HPP
+
+#include <cstring>
+#include <functional>
+#include <initializer_list>
+#include <memory>
+#include <new>
+#include <stdexcept>
+#include <utility>
+#include "controlGroup.hpp"
+#include "iteratorFlatHash.hpp"
+
+namespace duhanina
+{
+  template < class Key, class Value, class Hash = std::hash< Key >, class Equal = std::equal_to< Key > >
+  class FlatHashTable
+  {
+    friend class IteratorFlatHash< Key, Value, Hash, Equal, true >;
+    friend class IteratorFlatHash< Key, Value, Hash, Equal, false >;
+  public:
+
+    using iterator = IteratorFlatHash< Key, Value, Hash, Equal, false >;
+    using const_iterator = IteratorFlatHash< Key, Value, Hash, Equal, true >;
+
+    FlatHashTable();
+    FlatHashTable(const FlatHashTable& other);
+    FlatHashTable(FlatHashTable&& other) noexcept;
+    ~FlatHashTable();
+
+    template< typename InputIt >
+    FlatHashTable(InputIt, InputIt);
+
+    explicit FlatHashTable(std::initializer_list< std::pair< Key, Value > >);
+
+    FlatHashTable& operator=(const FlatHashTable& other);
+    FlatHashTable& operator=(FlatHashTable&& other) noexcept;
+
+    iterator begin() noexcept;
+    iterator end() noexcept;
+    const_iterator cbegin() const noexcept;
+    const_iterator cend() const noexcept;
+
+    Value& at(const Key& key);
+    const Value& at(const Key& key) const;
+    Value& operator[](const Key& key);
+
+    bool empty() const noexcept;
+    size_t size() const noexcept;
+
+    void clear() noexcept;
+    std::pair< iterator, bool > insert(const std::pair< Key, Value >& value);
+
+    template < typename InputIt >
+    void insert(InputIt first, InputIt last);
+
+    iterator erase(iterator pos) noexcept;
+    size_t erase(const Key& key) noexcept;
+    iterator erase(iterator first, iterator last) noexcept;
+
+    template < typename K, typename V >
+    std::pair< iterator, bool > emplace(K&& key, V&& value);
+
+    void swap(FlatHashTable& other) noexcept;
+
+    iterator find(const Key& key);
+    const_iterator find(const Key& key) const;
+    size_t count(const Key& key) const;
+
+    float load_factor() const noexcept;
+    float max_load_factor() const noexcept;
+    void max_load_factor(float ml);
+    void rehashFactor(size_t count);
+
+  private:
+    using value_type = std::pair< Key, Value >;
+    using Group = details::ControlGroup;
+
+    signed char* ctrl_;
+    value_type* slots_;
+    size_t capacity_;
+    size_t size_;
+    size_t deleted_;
+    float max_load_factor_ = 0.875;
+    Hash hasher_;
+    Equal key_equal_;
+
+    explicit FlatHashTable(size_t bucket_count, const Hash& hash = Hash(), const Equal& equal = Equal());
+    iterator makeIterator(size_t index) noexcept;
+    const_iterator makeIterator(size_t index) const noexcept;
+    size_t findIndex(const Key& key, size_t hash) const;
+    static size_t findFree(const signed char* ctrl, size_t capacity, size_t hash) noexcept;
+    template < typename... Args >
+    size_t emplaceUnique(size_t hash, Args&&... args);
+    size_t growthLimit(size_t capacity) const noexcept;
+    size_t capacityFor(size_t count) const noexcept;
+    void rehash(size_t new_capacity);
+    void destroy() noexcept;
+  };
+
+  template < class Key, class Value, class Hash, class Equal >
+  size_t FlatHashTable< Key, Value, Hash, Equal >::findIndex(const Key& key, size_t hash) const
+  {
+    if (size_ == 0)
+    {
+      return capacity_;
+    }
+    signed char fragment = details::hashFragment(hash);
+    size_t mask = capacity_ - 1;
+    size_t pos = (hash >> 7) & mask & ~(Group::width - 1);
+    for (size_t step = Group::width;; step += Group::width)
+    {
+      Group group(ctrl_ + pos);
+      for (uint64_t match = group.match(fragment); match; match &= match - 1)
+      {
+        size_t index = pos + Group::lowest(match);
+        if (key_equal_(slots_[index].first, key))
+        {
+          return index;
+        }
+      }
+      if (group.matchEmpty())
+      {
+        return capacity_;
+      }
+      pos = (pos + step) & mask;
+    }
+  }
+
+  template < class Key, class Value, class Hash, class Equal >
+  size_t FlatHashTable< Key, Value, Hash, Equal >::findFree(const signed char* ctrl, size_t capacity, size_t hash) noexcept
+  {
+    size_t mask = capacity - 1;
+    size_t pos = (hash >> 7) & mask & ~(Group::width - 1);
+    for (size_t step = Group::width;; step += Group::width)
+    {
+      uint64_t available = Group(ctrl + pos).matchFree();
+      if (available)
+      {
+        return pos + Group::lowest(available);
+      }
+      pos = (pos + step) & mask;
+    }
+  }
+
+  template < class Key, class Value, class Hash, class Equal >
+  template < typename... Args >
+  size_t FlatHashTable< Key, Value, Hash, Equal >::emplaceUnique(size_t hash, Args&&... args)
+  {
+    size_t index = findFree(ctrl_, capacity_, hash);
+    new (slots_ + index) value_type(std::forward< Args >(args)...);
+    if (ctrl_[index] == details::ctrlDeleted)
+    {
+      --deleted_;
+    }
+    ctrl_[index] = details::hashFragment(hash);
+    ++size_;
+    return index;
+  }
+
+  template < class Key, class Value, class Hash, class Equal >
+  size_t FlatHashTable< Key, Value, Hash, Equal >::growthLimit(size_t capacity) const noexcept
+  {
+    size_t limit = capacity * max_load_factor_;
+    return (capacity != 0 && limit >= capacity) ? capacity - 1 : limit;
+  }
+
+  template < class Key, class Value, class Hash, class Equal >
+  size_t FlatHashTable< Key, Value, Hash, Equal >::capacityFor(size_t count) const noexcept
+  {
+    size_t capacity = Group::width;
+    while (growthLimit(capacity) < count)
+    {
+      capacity *= 2;
+    }
+    return capacity;
+  }
+
+  template < class Key, class Value, class Hash, class Equal >
+  void FlatHashTable< Key, Value, Hash, Equal >::rehash(size_t new_capacity)
+  {
+    FlatHashTable< Key, Value, Hash, Equal > rebuilt(new_capacity, hasher_, key_equal_);
+    for (size_t i = 0; i < capacity_; ++i)
+    {
+      if (ctrl_[i] >= 0)
+      {
+        size_t hash = details::mixHash(hasher_(slots_[i].first));
+        rebuilt.emplaceUnique(hash, std::move_if_noexcept(slots_[i]));
+      }
+    }
+    rebuilt.max_load_factor_ = max_load_factor_;
+    swap(rebuilt);
+  }
+
+  template < class Key, class Value, class Hash, class Equal >
+  void FlatHashTable< Key, Value, Hash, Equal >::destroy() noexcept
+  {
+    for (size_t i = 0; i < capacity_ && size_ != 0; ++i)
+    {
+      if (ctrl_[i] >= 0)
+      {
+        slots_[i].~value_type();
+        --size_;
+      }
+    }
+    ::operator delete(slots_);
+    delete[] ctrl_;
+  }
+
+  template < class Key, class Value, class Hash, class Equal >
+  FlatHashTable< Key, Value, Hash, Equal >::FlatHashTable():
+    FlatHashTable(0)
+  {}
+
+  template < class Key, class Value, class Hash, class Equal >
+  FlatHashTable< Key, Value, Hash, Equal >::FlatHashTable(size_t bucket_count, const Hash& hash, const Equal& equal):
+    ctrl_(nullptr),
+    slots_(nullptr),
+    capacity_(0),
+    size_(0),
+    deleted_(0),
+    hasher_(hash),
+    key_equal_(equal)
+  {
+    if (bucket_count == 0)
+    {
+      return;
+    }
+    size_t capacity = Group::width;
+    while (capacity < bucket_count)
+    {
+      capacity *= 2;
+    }
+    ctrl_ = new signed char[capacity];
+    try
+    {
+      slots_ = static_cast< value_type* >(::operator new(capacity * sizeof(value_type)));
+    }
+    catch (...)
+    {
+      delete[] ctrl_;
+      throw;
+    }
+    std::memset(ctrl_, static_cast< unsigned char >(details::ctrlEmpty), capacity);
+    capacity_ = capacity;
+  }
+
+  template < class Key, class Value, class Hash, class Equal >
+  FlatHashTable< Key, Value, Hash, Equal >::FlatHashTable(const FlatHashTable& other):
+    FlatHashTable(other.capacity_, other.hasher_, other.key_equal_)
+  {
+    max_load_factor_ = other.max_load_factor_;
+    for (size_t i = 0; i < capacity_; ++i)
+    {
+      if (other.ctrl_[i] >= 0)
+      {
+        new (slots_ + i) value_type(other.slots_[i]);
+        ctrl_[i] = other.ctrl_[i];
+        ++size_;
+      }
+      else if (other.ctrl_[i] == details::ctrlDeleted)
+      {
+        ctrl_[i] = details::ctrlDeleted;
+        ++deleted_;
+      }
+    }
+  }
+
+  template < class Key, class Value, class Hash, class Equal >
+  FlatHashTable< Key, Value, Hash, Equal >::FlatHashTable(FlatHashTable&& other) noexcept:
+    ctrl_(std::exchange(other.ctrl_, nullptr)),
+    slots_(std::exchange(other.slots_, nullptr)),
+    capacity_(std::exchange(other.capacity_, 0)),
+    size_(std::exchange(other.size_, 0)),
+    deleted_(std::exchange(other.deleted_, 0)),
+    max_load_factor_(other.max_load_factor_),
+    hasher_(other.hasher_),
+    key_equal_(other.key_equal_)
+  {}
+
+  template < class Key, class Value, class Hash, class Equal >
+  FlatHashTable< Key, Value, Hash, Equal >::~FlatHashTable()
+  {
+    destroy();
+  }
+
+  template< typename Key, typename Value, typename Hash, typename Equal >
+  template< typename InputIt >
+  FlatHashTable< Key, Value, Hash, Equal >::FlatHashTable(InputIt first, InputIt last):
+    FlatHashTable()
+  {
+    for (auto it = first; it != last; it++)
+    {
+      insert(*it);
+    }
+  }
+
+  template< typename Key, typename Value, typename Hash, typename Equal >
+  FlatHashTable< Key, Value, Hash, Equal >::FlatHashTable(std::initializer_list< std::pair< Key, Value > > ilist):
+    FlatHashTable(ilist.begin(), ilist.end())
+  {}
+
+  template < class Key, class Value, class Hash, class Equal >
+  FlatHashTable< Key, Value, Hash, Equal >& FlatHashTable< Key, Value, Hash, Equal >::operator=(const FlatHashTable& other)
+  {
+    if (this != std::addressof(other))
+    {
+      FlatHashTable< Key, Value, Hash, Equal > temp(other);
+      swap(temp);
+    }
+    return *this;
+  }
+
+  template < class Key, class Value, class Hash, class Equal >
+  FlatHashTable< Key, Value, Hash, Equal >& FlatHashTable< Key, Value, Hash, Equal >::operator=(FlatHashTable&& other) noexcept
+  {
+    if (this != std::addressof(other))
+    {
+      FlatHashTable< Key, Value, Hash, Equal > temp(std::move(other));
+      swap(temp);
+    }
+    return *this;
+  }
+
+  template < class Key, class Value, class Hash, class Equal >
+  typename FlatHashTable< Key, Value, Hash, Equal >::iterator
+    FlatHashTable< Key, Value, Hash, Equal >::makeIterator(size_t index) noexcept
+  {
+    return iterator(ctrl_ + index, ctrl_ + capacity_, slots_ + index);
+  }
+
+  template < class Key, class Value, class Hash, class Equal >
+  typename FlatHashTable< Key, Value, Hash, Equal >::const_iterator
+    FlatHashTable< Key, Value, Hash, Equal >::makeIterator(size_t index) const noexcept
+  {
+    return const_iterator(ctrl_ + index, ctrl_ + capacity_, slots_ + index);
+  }
+
+  template < class Key, class Value, class Hash, class Equal >
+  typename FlatHashTable< Key, Value, Hash, Equal >::iterator FlatHashTable< Key, Value, Hash, Equal >::begin() noexcept
+  {
+    return makeIterator(0);
+  }
+
+  template < class Key, class Value, class Hash, class Equal >
+  typename FlatHashTable< Key, Value, Hash, Equal >::iterator FlatHashTable< Key, Value, Hash, Equal >::end() noexcept
+  {
+    return makeIterator(capacity_);
+  }
+
+  template < class Key, class Value, class Hash, class Equal >
+  typename FlatHashTable< Key, Value, Hash, Equal >::const_iterator
+    FlatHashTable< Key, Value, Hash, Equal >::cbegin() const noexcept
+  {
+    return makeIterator(0);
+  }
+
+  template < class Key, class Value, class Hash, class Equal >
+  typename FlatHashTable< Key, Value, Hash, Equal >::const_iterator
+    FlatHashTable< Key, Value, Hash, Equal >::cend() const noexcept
+  {
+    return makeIterator(capacity_);
+  }
+
+  template < class Key, class Value, class Hash, class Equal >
+  Value& FlatHashTable< Key, Value, Hash, Equal >::at(const Key& key)
+  {
+    auto it = find(key);
+    if (it == end())
+    {
+      throw std::out_of_range("Key not found");
+    }
+    return it->second;
+  }
+
+  template < class Key, class Value, class Hash, class Equal >
+  const Value& FlatHashTable< Key, Value, Hash, Equal >::at(const Key& key) const
+  {
+    auto it = find(key);
+    if (it == cend())
+    {
+      throw std::out_of_range("Key not found");
+    }
+    return it->second;
+  }
+
+  template < class Key, class Value, class Hash, class Equal >
+  Value& FlatHashTable< Key, Value, Hash, Equal >::operator[](const Key& key)
+  {
+    return emplace(key, Value()).first->second;
+  }
+
+  template < class Key, class Value, class Hash, class Equal >
+  bool FlatHashTable< Key, Value, Hash, Equal >::empty() const noexcept
+  {
+    return size_ == 0;
+  }
+
+  template < class Key, class Value, class Hash, class Equal >
+  size_t FlatHashTable< Key, Value, Hash, Equal >::size() const noexcept
+  {
+    return size_;
+  }
+
+  template < class Key, class Value, class Hash, class Equal >
+  void FlatHashTable< Key, Value, Hash, Equal >::clear() noexcept
+  {
+    for (size_t i = 0; i < capacity_; ++i)
+    {
+      if (ctrl_[i] >= 0)
+      {
+        slots_[i].~value_type();
+      }
+    }
+    if (capacity_ != 0)
+    {
+      std::memset(ctrl_, static_cast< unsigned char >(details::ctrlEmpty), capacity_);
+    }
+    size_ = 0;
+    deleted_ = 0;
+  }
+
+  template < class Key, class Value, class Hash, class Equal >
+  std::pair< typename FlatHashTable< Key, Value, Hash, Equal >::iterator, bool >
+    FlatHashTable< Key, Value, Hash, Equal >::insert(const std::pair< Key, Value >& value)
+  {
+    return emplace(value.first, value.second);
+  }
+
+  template < class Key, class Value, class Hash, class Equal >
+  template < typename InputIt >
+  void FlatHashTable< Key, Value, Hash, Equal >::insert(InputIt first, InputIt last)
+  {
+    for (; first != last; ++first)
+    {
+      insert(*first);
+    }
+  }
+
+  template < class Key, class Value, class Hash, class Equal >
+  template < typename K, typename V >
+  std::pair< typename FlatHashTable< Key, Value, Hash, Equal >::iterator, bool >
+    FlatHashTable< Key, Value, Hash, Equal >::emplace(K&& key, V&& value)
+  {
+    size_t hash = details::mixHash(hasher_(key));
+    size_t index = findIndex(key, hash);
+    if (index != capacity_)
+    {
+      return { makeIterator(index), false };
+    }
+    if (size_ + deleted_ >= growthLimit(capacity_))
+    {
+      rehash(capacityFor(size_ + size_ / 8 + 1));
+    }
+    index = emplaceUnique(hash, std::forward< K >(key), std::forward< V >(value));
+    return { makeIterator(index), true };
+  }
+
+  template < class Key, class Value, class Hash, class Equal >
+  typename FlatHashTable< Key, Value, Hash, Equal >::iterator
+    FlatHashTable< Key, Value, Hash, Equal >::erase(iterator pos) noexcept
+  {
+    if (pos == end())
+    {
+      return end();
+    }
+    size_t index = pos.slot_ - slots_;
+    slots_[index].~value_type();
+    if (Group(ctrl_ + (index & ~(Group::width - 1))).matchEmpty())
+    {
+      ctrl_[index] = details::ctrlEmpty;
+    }
+    else
+    {
+      ctrl_[index] = details::ctrlDeleted;
+      ++deleted_;
+    }
+    --size_;
+    return makeIterator(index);
+  }
+
+  template < class Key, class Value, class Hash, class Equal >
+  size_t FlatHashTable< Key, Value, Hash, Equal >::erase(const Key& key) noexcept
+  {
+    auto it = find(key);
+    if (it != end())
+    {
+      erase(it);
+      return 1;
+    }
+    return 0;
+  }
+
+  template < class Key, class Value, class Hash, class Equal >
+  typename FlatHashTable< Key, Value, Hash, Equal >::iterator
+    FlatHashTable< Key, Value, Hash, Equal >::erase(iterator first, iterator last) noexcept
+  {
+    while (first != last)
+    {
+      first = erase(first);
+    }
+    return last;
+  }
+
+  template < class Key, class Value, class Hash, class Equal >
+  void FlatHashTable< Key, Value, Hash, Equal >::swap(FlatHashTable& other) noexcept
+  {
+    std::swap(ctrl_, other.ctrl_);
+    std::swap(slots_, other.slots_);
+    std::swap(capacity_, other.capacity_);
+    std::swap(size_, other.size_);
+    std::swap(deleted_, other.deleted_);
+    std::swap(max_load_factor_, other.max_load_factor_);
+    std::swap(hasher_, other.hasher_);
+    std::swap(key_equal_, other.key_equal_);
+  }
+
+  template < class Key, class Value, class Hash, class Equal >
+  typename FlatHashTable< Key, Value, Hash, Equal >::iterator
+    FlatHashTable< Key, Value, Hash, Equal >::find(const Key& key)
+  {
+    return makeIterator(findIndex(key, details::mixHash(hasher_(key))));
+  }
+
+  template < class Key, class Value, class Hash, class Equal >
+  typename FlatHashTable< Key, Value, Hash, Equal >::const_iterator
+    FlatHashTable< Key, Value, Hash, Equal >::find(const Key& key) const
+  {
+    return makeIterator(findIndex(key, details::mixHash(hasher_(key))));
+  }
+
+  template < class Key, class Value, class Hash, class Equal >
+  size_t FlatHashTable< Key, Value, Hash, Equal >::count(const Key& key) const
+  {
+    if (findIndex(key, details::mixHash(hasher_(key))) != capacity_)
+    {
+      return 1;
+    }
+    return 0;
+  }
+
+  template < class Key, class Value, class Hash, class Equal >
+  float FlatHashTable< Key, Value, Hash, Equal >::load_factor() const noexcept
+  {
+    if (capacity_ == 0)
+    {
+      return 0.0;
+    }
+    float current_size = size_;
+    float table_size = capacity_;
+    return current_size / table_size;
+  }
+
+  template < class Key, class Value, class Hash, class Equal >
+  float FlatHashTable< Key, Value, Hash, Equal >::max_load_factor() const noexcept
+  {
+    return max_load_factor_;
+  }
+
+  template < class Key, class Value, class Hash, class Equal >
+  void FlatHashTable< Key, Value, Hash, Equal >::max_load_factor(float ml)
+  {
+    if (ml <= 0.0 || ml > 1.0)
+    {
+      throw std::invalid_argument("Invalid max load factor");
+    }
+    max_load_factor_ = ml;
+    if (size_ + deleted_ > growthLimit(capacity_))
+    {
+      rehash(capacityFor(size_));
+    }
+  }
+
+  template < class Key, class Value, class Hash, class Equal >
+  void FlatHashTable< Key, Value, Hash, Equal >::rehashFactor(size_t count)
+  {
+    size_t capacity = capacityFor(size_);
+    while (capacity < count)
+    {
+      capacity *= 2;
+    }
+    if (capacity != capacity_ || deleted_ != 0)
+    {
+      rehash(capacity);
+    }
+  }
+}
+
+#endif
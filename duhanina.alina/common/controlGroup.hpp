@@ -0,0 +1,128 @@
+#ifndef CONTROLGROUP_HPP
+#define CONTROLGROUP_HPP
+
+#include <cstddef>
+#include <cstdint>
+#ifdef __SSE2__
+#include <emmintrin.h>
+#endif
+
+namespace duhanina
+{
+  namespace details
+  {
+    constexpr signed char ctrlEmpty = -128;
+    constexpr signed char ctrlDeleted = -2;
+    constexpr signed char ctrlFree = -1;
+
+    inline size_t mixHash(size_t hash) noexcept
+    {
+      unsigned long long mixed = static_cast< unsigned long long >(hash) * 0x9E3779B97F4A7C15ULL;
+      return static_cast< size_t >(mixed ^ (mixed >> 32));
+    }
+
+    inline signed char hashFragment(size_t hash) noexcept
+    {
+      return static_cast< signed char >(hash & 0x7F);
+    }
+
+    inline size_t lowestBit(uint64_t mask) noexcept
+    {
+#if defined(__GNUC__)
+      return __builtin_ctzll(mask);
+#else
+      size_t index = 0;
+      while (!(mask & 1))
+      {
+        mask >>= 1;
+        ++index;
+      }
+      return index;
+#endif
+    }
+
+#ifdef __SSE2__
+    class SseControlGroup
+    {
+    public:
+      static constexpr size_t width = 16;
+
+      explicit SseControlGroup(const signed char* ctrl) noexcept:
+        ctrl_(_mm_loadu_si128(reinterpret_cast< const __m128i* >(ctrl)))
+      {}
+
+      uint64_t match(signed char fragment) const noexcept
+      {
+        return static_cast< uint32_t >(_mm_movemask_epi8(_mm_cmpeq_epi8(_mm_set1_epi8(fragment), ctrl_)));
+      }
+
+      uint64_t matchEmpty() const noexcept
+      {
+        return match(ctrlEmpty);
+      }
+
+      uint64_t matchFree() const noexcept
+      {
+        return static_cast< uint32_t >(_mm_movemask_epi8(_mm_cmpgt_epi8(_mm_set1_epi8(ctrlFree), ctrl_)));
+      }
+
+      static size_t lowest(uint64_t mask) noexcept
+      {
+        return lowestBit(mask);
+      }
+
+    private:
+      __m128i ctrl_;
+    };
+#endif
+
+    class SwarControlGroup
+    {
+    public:
+      static constexpr size_t width = 8;
+
+      explicit SwarControlGroup(const signed char* ctrl) noexcept:
+        word_(0)
+      {
+        for (size_t i = 0; i < width; ++i)
+        {
+          word_ |= static_cast< uint64_t >(static_cast< unsigned char >(ctrl[i])) << (8 * i);
+        }
+      }
+
+      uint64_t match(signed char fragment) const noexcept
+      {
+        uint64_t diff = word_ ^ (lsbs * static_cast< unsigned char >(fragment));
+        return (diff - lsbs) & ~diff & msbs;
+      }
+
+      uint64_t matchEmpty() const noexcept
+      {
+        return word_ & (~word_ << 6) & msbs;
+      }
+
+      uint64_t matchFree() const noexcept
+      {
+        return word_ & (~word_ << 7) & msbs;
+      }
+
+      static size_t lowest(uint64_t mask) noexcept
+      {
+        return lowestBit(mask) >> 3;
+      }
+
+    private:
+      static constexpr uint64_t lsbs = 0x0101010101010101ULL;
+      static constexpr uint64_t msbs = 0x8080808080808080ULL;
+      uint64_t word_;
+    };
+
+#ifdef __SSE2__
+    using ControlGroup = SseControlGroup;
+#else
+    using ControlGroup = SwarControlGroup;
+#endif
+  }
+}
+
+#endif
@@ -0,0 +1,116 @@
+#ifndef ITERATORFLATHASH_HPP
+#define ITERATORFLATHASH_HPP
+
+#include <type_traits>
+#include <utility>
+
+namespace duhanina
+{
+  template< typename Key, typename Value, typename Hash, typename Equal >
+  class FlatHashTable;
+
+  template < class Key, class Value, class Hash, class Equal, bool isConst >
+  class IteratorFlatHash
+  {
+    friend class FlatHashTable< Key, Value, Hash, Equal >;
+    friend class IteratorFlatHash< Key, Value, Hash, Equal, true >;
+    friend class IteratorFlatHash< Key, Value, Hash, Equal, false >;
+  public:
+    using value_type = std::conditional_t< isConst, const std::pair< Key, Value >, std::pair< Key, Value > >;
+    using pointer = value_type*;
+    using reference = value_type&;
+
+    IteratorFlatHash() noexcept;
+
+    reference operator*() const noexcept;
+    pointer operator->() const noexcept;
+
+    IteratorFlatHash& operator++() noexcept;
+    IteratorFlatHash operator++(int) noexcept;
+
+    bool operator==(const IteratorFlatHash& other) const noexcept;
+    bool operator!=(const IteratorFlatHash& other) const noexcept;
+
+  private:
+    const signed char* ctrl_;
+    const signed char* end_;
+    pointer slot_;
+
+    IteratorFlatHash(const signed char* ctrl, const signed char* end, pointer slot) noexcept;
+    void skip_empty() noexcept;
+  };
+
+  template < class Key, class Value, class Hash, class Equal, bool isConst >
+  void IteratorFlatHash< Key, Value, Hash, Equal, isConst >::skip_empty() noexcept
+  {
+    while (ctrl_ != end_ && *ctrl_ < 0)
+    {
+      ++ctrl_;
+      ++slot_;
+    }
+  }
+
+  template < class Key, class Value, class Hash, class Equal, bool isConst >
+  IteratorFlatHash< Key, Value, Hash, Equal, isConst >::IteratorFlatHash() noexcept:
+    ctrl_(nullptr),
+    end_(nullptr),
+    slot_(nullptr)
+  {}
+
+  template < class Key, class Value, class Hash, class Equal, bool isConst >
+  IteratorFlatHash< Key, Value, Hash, Equal, isConst >::IteratorFlatHash(const signed char* ctrl,
+      const signed char* end, pointer slot) noexcept:
+    ctrl_(ctrl),
+    end_(end),
+    slot_(slot)
+  {
+    skip_empty();
+  }
+
+  template < class Key, class Value, class Hash, class Equal, bool isConst >
+  typename IteratorFlatHash< Key, Value, Hash, Equal, isConst >::reference
+    IteratorFlatHash< Key, Value, Hash, Equal, isConst >::operator*() const noexcept
+  {
+    return *slot_;
+  }
+
+  template < class Key, class Value, class Hash, class Equal, bool isConst >
+  typename IteratorFlatHash< Key, Value, Hash, Equal, isConst >::pointer
+    IteratorFlatHash< Key, Value, Hash, Equal, isConst >::operator->() const noexcept
+  {
+    return slot_;
+  }
+
+  template < class Key, class Value, class Hash, class Equal, bool isConst >
+  typename IteratorFlatHash< Key, Value, Hash, Equal, isConst >::IteratorFlatHash&
+    IteratorFlatHash< Key, Value, Hash, Equal, isConst >::operator++() noexcept
+  {
+    ++ctrl_;
+    ++slot_;
+    skip_empty();
+    return *this;
+  }
+
+  template < class Key, class Value, class Hash, class Equal, bool isConst >
+  typename IteratorFlatHash< Key, Value, Hash, Equal, isConst >::IteratorFlatHash
+    IteratorFlatHash< Key, Value, Hash, Equal, isConst >::operator++(int) noexcept
+  {
+    IteratorFlatHash tmp = *this;
+    ++(*this);
+    return tmp;
+  }
+
+  template < class Key, class Value, class Hash, class Equal, bool isConst >
+  bool IteratorFlatHash< Key, Value, Hash, Equal, isConst >::operator==(const IteratorFlatHash& other) const noexcept
+  {
+    return slot_ == other.slot_;
+  }
+
+  template < class Key, class Value, class Hash, class Equal, bool isConst >
+  bool IteratorFlatHash< Key, Value, Hash, Equal, isConst >::operator!=(const IteratorFlatHash& other) const noexcept
+  {
+    return !(*this == other);
+  }
+}
+
+#endif
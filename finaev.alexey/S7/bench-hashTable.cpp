@@ -0,0 +1,7 @@
+#include <bench.hpp>
+#include <hashTable.hpp>
+
+namespace
+{
+  const bench::Registrar table("finaev::HashTable", bench::runMap< finaev::HashTable< int, int > >);
+}
@@ -101,6 +101,28 @@ void finaev::inBound(std::istream& in, std::ostream& out, const graphsTree& grap
   }
 }
 
+void finaev::stats(std::istream& in, std::ostream& out, const graphsTree& graphs)
+{
+  std::string name;
+  in >> name;
+  if (graphs.find(name) == graphs.cEnd())
+  {
+    throw std::logic_error("<INVALID COMMAND>");
+  }
+  HashTableStats st = graphs.at(name).getEdgesStats();
+  out << "size " << st.size << "\n";
+  out << "capacity " << st.capacity << "\n";
+  out << "tombstones " << st.tombstones << "\n";
+  out << "rehashes " << st.rehashes << "\n";
+  out << "probe " << st.avgProbe << " " << st.maxProbe << "\n";
+  out << "occupancy";
+  for (size_t i = 0; i < st.occupancy.size(); ++i)
+  {
+    out << " " << st.occupancy[i];
+  }
+  out << "\n";
+}
+
 void finaev::bind(std::istream& in, graphsTree& graphs)
 {
   std::string name, vert1, vert2;
@@ -217,6 +239,7 @@ cmdMap finaev::createCommandsHandler(std::istream& in, std::ostream& out, graphs
   commands["vertexes"] = std::bind(vertexes, std::ref(in), std::ref(out), std::cref(graphs));
   commands["outbound"] = std::bind(outBound, std::ref(in), std::ref(out), std::cref(graphs));
   commands["inbound"] = std::bind(inBound, std::ref(in), std::ref(out), std::cref(graphs));
+  commands["stats"] = std::bind(stats, std::ref(in), std::ref(out), std::cref(graphs));
   commands["bind"] = std::bind(bind, std::ref(in), std::ref(graphs));
   commands["cut"] = std::bind(cut, std::ref(in), std::ref(graphs));
   commands["merge"] = std::bind(merge, std::ref(in), std::ref(graphs));
@@ -12,6 +12,7 @@ namespace finaev
   void vertexes(std::istream& in, std::ostream& out, const graphsTree& graphs);
   void outBound(std::istream& in, std::ostream& out, const graphsTree& graphs);
   void inBound(std::istream& in, std::ostream& out, const graphsTree& graphs);
+  void stats(std::istream& in, std::ostream& out, const graphsTree& graphs);
   void bind(std::istream& in, graphsTree& graphs);
   void cut(std::istream& in, graphsTree& graphs);
   void create(std::istream& in, graphsTree& graphs);
@@ -57,6 +57,11 @@ typename finaev::Graph::hashMapForEdges finaev::Graph::getEdges() const
   return edges_;
 }
 
+finaev::HashTableStats finaev::Graph::getEdgesStats() const
+{
+  return edges_.stats();
+}
+
 bool finaev::Graph::hasVert(const std::string& str) const
 {
   return vertexes_.find(str) != vertexes_.cEnd();
@@ -27,6 +27,7 @@ namespace finaev
     bool removeEdge(const std::string& first, const std::string& second, size_t weigth);
     AVLtree< std::string, bool > getVertexes() const;
     hashMapForEdges getEdges() const;
+    HashTableStats getEdgesStats() const;
     bool hasVert(const std::string& str) const;
     AVLtree< std::string, AVLtree< size_t, size_t > > getOutBound(const std::string& str) const;
     AVLtree< std::string, AVLtree< size_t, size_t > > getInBound(const std::string& str) const;
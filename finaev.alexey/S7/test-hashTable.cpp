@@ -63,3 +63,53 @@ BOOST_AUTO_TEST_CASE(rehash_test)
   table.rehash(old_size * 2);
   BOOST_TEST(table.size() == old_size);
 }
+
+BOOST_AUTO_TEST_CASE(collision_test)
+{
+  finaev::HashTable< int, int > table;
+  for (int i = 0; i < 8; ++i)
+  {
+    table[i * 16] = i;
+  }
+  for (int i = 0; i < 8; ++i)
+  {
+    BOOST_TEST((table.find(i * 16) != table.end()));
+  }
+  table.erase(16);
+  table.insert(std::make_pair(256, 16));
+  BOOST_TEST(table.find(256)->second == 16);
+  BOOST_TEST((table.find(16) == table.end()));
+  BOOST_TEST(table.size() == 8);
+  BOOST_TEST(table.stats().tombstones == 0);
+}
+
+BOOST_AUTO_TEST_CASE(stats_test)
+{
+  finaev::HashTable< int, int > table;
+  finaev::HashTableStats empty = table.stats();
+  BOOST_TEST(empty.size == 0);
+  BOOST_TEST(empty.capacity == 16);
+  BOOST_TEST(empty.rehashes == 0);
+  BOOST_TEST(empty.occupancy.size() == 16);
+
+  for (int i = 0; i < 100; ++i)
+  {
+    table[i] = i;
+  }
+  for (int i = 0; i < 30; ++i)
+  {
+    table.erase(i);
+  }
+  finaev::HashTableStats st = table.stats();
+  BOOST_TEST(st.size == 70);
+  BOOST_TEST(st.tombstones == 30);
+  BOOST_TEST(st.rehashes == 4);
+  BOOST_TEST(st.maxProbe == 1);
+  BOOST_TEST(st.avgProbe == 1.0);
+  size_t occupied = 0;
+  for (size_t i = 0; i < st.occupancy.size(); ++i)
+  {
+    occupied += st.occupancy[i];
+  }
+  BOOST_TEST(occupied == 70);
+}
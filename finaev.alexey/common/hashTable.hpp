@@ -1,8 +1,10 @@
 #ifndef HASHTABLE_HPP
 #define HASHTABLE_HPP
+#include <algorithm>
 #include <functional>
 #include "dynamicArr.hpp"
 #include "hashTableSlot.hpp"
+#include "hashTableStats.hpp"
 #include "hashTableconstIterator.hpp"
 #include "hashTableIterator.hpp"
 
@@ -41,12 +43,14 @@ namespace finaev
     std::pair< Iter, bool > insert(pair& val);
 
     void rehash(size_t n);
+    HashTableStats stats() const;
   private:
     DynamicArr< Slot< Key, Value > > table_;
     size_t size_;
     Hash hasher_;
     Equal equal_;
     float max_load_factor_ = 0.7;
+    size_t rehashes_ = 0;
 
     size_t findIndex(const Key & k) const;
     size_t findIndexIn(const Key & k, const DynamicArr< Slot< Key, Value > >& table) const;
@@ -78,6 +82,7 @@ namespace finaev
     std::swap(hasher_, rhs.hasher_);
     std::swap(equal_, rhs.equal_);
     std::swap(max_load_factor_, rhs.max_load_factor_);
+    std::swap(rehashes_, rhs.rehashes_);
   }
 
   template< class Key, class Value, class Hash, class Equal >
@@ -159,6 +164,39 @@ namespace finaev
       }
     }
     table_.swap(temp);
+    ++rehashes_;
+  }
+
+  template< class Key, class Value, class Hash, class Equal >
+  HashTableStats HashTable< Key, Value, Hash, Equal >::stats() const
+  {
+    size_t groups = std::min< size_t >(16, table_.size());
+    HashTableStats res{ size_, table_.size(), 0, rehashes_, 0, 0.0, DynamicArr< size_t >(groups) };
+    for (size_t i = 0; i < groups; ++i)
+    {
+      res.occupancy[i] = 0;
+    }
+    size_t totalProbe = 0;
+    for (size_t i = 0; i < table_.size(); ++i)
+    {
+      if (table_[i].deleted)
+      {
+        ++res.tombstones;
+      }
+      else if (table_[i].occupied)
+      {
+        size_t baseSlot = hasher_(table_[i].data.first) % table_.size();
+        size_t probe = (i + table_.size() - baseSlot) % table_.size() + 1;
+        totalProbe += probe;
+        res.maxProbe = std::max(res.maxProbe, probe);
+        ++res.occupancy[i * groups / table_.size()];
+      }
+    }
+    if (size_ != 0)
+    {
+      res.avgProbe = static_cast< double >(totalProbe) / size_;
+    }
+    return res;
   }
 
   template< class Key, class Value, class Hash, class Equal >
@@ -268,10 +306,10 @@ namespace finaev
       {
         break;
       }
-      currSlot = (baseSlot + i * i) % table_.size();
+      currSlot = (baseSlot + i) % table_.size();
       ++i;
     }
-    if (i > table_.size() && firstDeleted != table_.size())
+    if (firstDeleted != table_.size())
     {
       currSlot = firstDeleted;
     }
@@ -0,0 +1,20 @@
+#ifndef HASHTABLESTATS_HPP
+#define HASHTABLESTATS_HPP
+#include <cstddef>
+#include "dynamicArr.hpp"
+
+namespace finaev
+{
+  struct HashTableStats
+  {
+    size_t size;
+    size_t capacity;
+    size_t tombstones;
+    size_t rehashes;
+    size_t maxProbe;
+    double avgProbe;
+    DynamicArr< size_t > occupancy;
+  };
+}
+
+#endif
@@ -0,0 +1,20 @@
+#include <bench.hpp>
+#include "list.hpp"
+
+namespace
+{
+  struct ListTraits: bench::SequenceTraits< kiselev::List< int > >
+  {
+    static void push(kiselev::List< int >& list, int value)
+    {
+      list.pushBack(value);
+    }
+
+    static void pop(kiselev::List< int >& list)
+    {
+      list.popFront();
+    }
+  };
+
+  const bench::Registrar list("kiselev::List", bench::runSequence< kiselev::List< int >, ListTraits >);
+}
@@ -0,0 +1,7 @@
+#include <bench.hpp>
+#include "tree.hpp"
+
+namespace
+{
+  const bench::Registrar tree("kiselev::RBTree", bench::runMap< kiselev::RBTree< int, int > >);
+}
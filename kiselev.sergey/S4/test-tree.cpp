@@ -107,6 +107,53 @@ BOOST_AUTO_TEST_CASE(erase_position)
   tree.erase(tree.cbegin(), tree.cend());
   BOOST_TEST(tree.empty());
 }
+
+BOOST_AUTO_TEST_CASE(erase_random_order)
+{
+  RBTree< size_t, size_t > tree;
+  const size_t count = 256;
+  for (size_t i = 0; i < count; ++i)
+  {
+    tree.insert({ i, i });
+  }
+  size_t removed = 0;
+  for (size_t step = 0; step < count; ++step)
+  {
+    size_t key = (step * 97 + 31) % count;
+    BOOST_TEST(tree.erase(key) == 1);
+    ++removed;
+    BOOST_TEST(tree.size() == count - removed);
+    size_t visited = 0;
+    size_t previous = 0;
+    for (auto it = tree.cbegin(); it != tree.cend(); ++it)
+    {
+      BOOST_TEST((visited == 0 || previous < (*it).first));
+      previous = (*it).first;
+      ++visited;
+    }
+    BOOST_TEST(visited == tree.size());
+  }
+  BOOST_TEST(tree.empty());
+  BOOST_TEST((tree.begin() == tree.end()));
+  tree.insert({ 1, 1 });
+  BOOST_TEST(tree.size() == 1);
+  BOOST_TEST(tree.at(1) == 1);
+}
+
+BOOST_AUTO_TEST_CASE(erase_range_to_end)
+{
+  RBTree< size_t, size_t > tree;
+  for (size_t i = 0; i < 64; ++i)
+  {
+    tree.insert({ i, i });
+  }
+  auto it = tree.erase(tree.find(20), tree.end());
+  BOOST_TEST((it == tree.end()));
+  BOOST_TEST(tree.size() == 20);
+  BOOST_TEST((tree.find(19) != tree.end()));
+  BOOST_TEST((tree.find(20) == tree.end()));
+}
+
 BOOST_AUTO_TEST_CASE(emplace_element_and_hint)
 {
   RBTree< size_t, std::string > tree;
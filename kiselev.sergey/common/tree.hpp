@@ -115,7 +115,7 @@ namespace kiselev
     void rotateLeft(Node* node) noexcept;
     void rotateRight(Node* node) noexcept;
     void fixInsert(Node* node) noexcept;
-    void fixDelete(Node* node) noexcept;
+    void fixDelete(Node* node, Node* parent) noexcept;
     Node* root_;
     Cmp cmp_;
     size_t size_;
@@ -306,81 +306,77 @@ namespace kiselev
   }
 
   template< typename Key, typename Value, typename Cmp >
-  void RBTree< Key, Value, Cmp >::fixDelete(Node* node) noexcept
+  void RBTree< Key, Value, Cmp >::fixDelete(Node* node, Node* parent) noexcept
   {
-    while (node != root_ && node->color == Color::BLACK)
+    while (node != root_ && (!node || node->color == Color::BLACK))
     {
-      if (node == node->parent->left)
+      if (node == parent->left)
       {
-        Node* brother = node->parent->right;
-        if (brother && brother->color == Color::RED)
+        Node* brother = parent->right;
+        if (brother->color == Color::RED)
         {
           brother->color = Color::BLACK;
-          node->parent->color = Color::RED;
-          rotateLeft(node->parent);
-          brother = node->parent->right;
+          parent->color = Color::RED;
+          rotateLeft(parent);
+          brother = parent->right;
         }
         if ((!brother->left || brother->left->color == Color::BLACK) && (!brother->right || brother->right->color == Color::BLACK))
         {
           brother->color = Color::RED;
-          node = node->parent;
+          node = parent;
+          parent = node->parent;
         }
         else
         {
           if (!brother->right || brother->right->color == Color::BLACK)
           {
-            if (brother->left)
-            {
-              brother->left->color = Color::BLACK;
-            }
+            brother->left->color = Color::BLACK;
             brother->color = Color::RED;
             rotateRight(brother);
-            brother = node->parent->right;
+            brother = parent->right;
           }
-          brother->color = node->parent->color;
-          node->parent->color = Color::BLACK;
+          brother->color = parent->color;
+          parent->color = Color::BLACK;
           if (brother->right)
           {
             brother->right->color = Color::BLACK;
           }
-          rotateLeft(node->parent);
+          rotateLeft(parent);
           node = root_;
         }
       }
       else
       {
-        Node* brother = node->parent->left;
-        if (brother && brother->color == Color::RED)
+        Node* brother = parent->left;
+        if (brother->color == Color::RED)
         {
           brother->color = Color::BLACK;
-          node->parent->color = Color::RED;
-          rotateRight(node->parent);
-          brother = node->parent->left;
+          parent->color = Color::RED;
+          rotateRight(parent);
+          brother = parent->left;
         }
         if ((!brother->left || brother->left->color == Color::BLACK) && (!brother->right || brother->right->color == Color::BLACK))
         {
           brother->color = Color::RED;
-          node = node->parent;
+          node = parent;
+          parent = node->parent;
         }
         else
         {
           if (!brother->left || brother->left->color == Color::BLACK)
           {
-            if (brother->right)
-            {
-              brother->right->color = Color::BLACK;
-            }
+            brother->right->color = Color::BLACK;
             brother->color = Color::RED;
             rotateLeft(brother);
-            brother = node->parent->left;
+            brother = parent->left;
           }
-          brother->color = node->parent->color;
-          node->parent->color = Color::BLACK;
+          brother->color = parent->color;
+          parent->color = Color::BLACK;
           if (brother->left)
           {
             brother->left->color = Color::BLACK;
           }
-          rotateRight(node->parent);
+          rotateRight(parent);
           node = root_;
         }
       }
@@ -823,6 +819,7 @@ namespace kiselev
     if (size_ == 1)
     {
       delete root_;
+      root_ = nullptr;
       size_ = 0;
       return end();
     }
@@ -838,6 +835,12 @@ namespace kiselev
         replace = replace->left;
       }
     }
+    Iterator next(toDelete, false);
+    if (replace == toDelete)
+    {
+      ++next;
+    }
+    Node* parent = replace->parent;
     child = replace->left ? replace->left : replace->right;
     if (child)
     {
@@ -861,13 +864,11 @@ namespace kiselev
     }
     if (replace->color == Color::BLACK)
     {
-      fixDelete(child ? child : replace->parent);
+      fixDelete(child, parent);
     }
-    Iterator next(pos.node_, pos.isEnd_);
-    ++next;
     delete replace;
     --size_;
-    return next;
+    return next.isEnd_ ? end() : next;
   }
 
   template< typename Key, typename Value, typename Cmp >
@@ -892,11 +893,11 @@ namespace kiselev
   template< typename Key, typename Value, typename Cmp >
   typename RBTree< Key, Value, Cmp >::Iterator RBTree< Key, Value, Cmp >::erase(ConstIterator first, ConstIterator last) noexcept
   {
-    while (first != last)
+    while (first != last && !first.isEnd_)
     {
       first = erase(first);
     }
-    return Iterator(last.node_, last.isEnd_);
+    return first.isEnd_ ? end() : Iterator(last.node_, last.isEnd_);
   }
 
   template< typename Key, typename Value, typename Cmp >
@@ -195,19 +195,13 @@ void kizhin::CommandProcessor::handleInter(const CmdArgs& args) const
   }
   const FrequencyDictionary first = loadDictionary(state_[args[0]]);
   const FrequencyDictionary second = loadDictionary(state_[args[1]]);
-  std::set< std::string > intersection{};
-  const auto ins = std::inserter(intersection, intersection.end());
-  const WordSet& firstW = first.wordSet;
-  const WordSet& secondW = second.wordSet;
-  const auto beg = firstW.begin();
-  std::set_intersection(beg, firstW.end(), secondW.begin(), secondW.end(), ins);
   WordMap result{};
   const auto inserter = std::inserter(result, result.end());
-  std::size_t (WordSet::*count)(const std::string&) const = &WordSet::count;
+  std::size_t (WordMap::*count)(const std::string&) const = &WordMap::count;
   using std::placeholders::_1;
   static const auto getFirst = std::bind(&WordMap::value_type::first, _1);
-  const auto interPtr = std::addressof(intersection);
-  const auto contains = std::bind(count, interPtr, std::bind(getFirst, _1));
+  const auto secondPtr = std::addressof(second.wordMap);
+  const auto contains = std::bind(count, secondPtr, std::bind(getFirst, _1));
   std::copy_if(first.wordMap.begin(), first.wordMap.end(), inserter, contains);
   using OutIt = std::ostream_iterator< std::string >;
   std::transform(result.begin(), result.end(), OutIt{ out_, "\n" }, wordAndSizeToString);
@@ -226,18 +220,13 @@ void kizhin::CommandProcessor::handleDiff(const CmdArgs& args) const
   const FrequencyDictionary first = loadDictionary(state_[args[0]]);
   const FrequencyDictionary second = loadDictionary(state_[args[1]]);
   using std::placeholders::_1;
-  std::set< std::string > difference{};
-  const auto ins = std::inserter(difference, difference.end());
-  const WordSet& firstW = first.wordSet;
-  const WordSet& secondW = second.wordSet;
-  std::set_difference(firstW.begin(), firstW.end(), secondW.begin(), secondW.end(), ins);
   WordMap result{};
   const auto inserter = std::inserter(result, result.end());
-  std::size_t (WordSet::*count)(const std::string&) const = &WordSet::count;
+  std::size_t (WordMap::*count)(const std::string&) const = &WordMap::count;
   static const auto getFirst = std::bind(&WordMap::value_type::first, _1);
-  const auto diffPtr = std::addressof(difference);
-  const auto contains = std::bind(count, diffPtr, std::bind(getFirst, _1));
-  std::copy_if(first.wordMap.begin(), first.wordMap.end(), inserter, contains);
+  const auto secondPtr = std::addressof(second.wordMap);
+  const auto contains = std::bind(count, secondPtr, std::bind(getFirst, _1));
+  std::remove_copy_if(first.wordMap.begin(), first.wordMap.end(), inserter, contains);
   using OutIt = std::ostream_iterator< std::string >;
   std::transform(result.begin(), result.end(), OutIt{ out_, "\n" }, wordAndSizeToString);
 }
@@ -252,7 +241,7 @@ void kizhin::CommandProcessor::handleStat(const CmdArgs& args) const
     return;
   }
   const FrequencyDictionary dict = loadDictionary(state_.at(args[0]));
-  const SizeSet& freqDict = dict.sizeSet;
+  const SizeSet freqDict = rankWords(dict);
   if (freqDict.empty()) {
     out_ << "Dictionary is empty\n";
     return;
@@ -294,7 +283,7 @@ void kizhin::CommandProcessor::handleTop(const CmdArgs& args) const
   }
   const std::size_t count = args.size() == 2 ? std::stoull(args[1]) : 5;
   const FrequencyDictionary dict = loadDictionary(state_[args[0]]);
-  const SizeSet& freqDict = dict.sizeSet;
+  const SizeSet freqDict = rankWords(dict);
   const bool beforeEnd = count < freqDict.size();
   const auto end = beforeEnd ? std::next(freqDict.begin(), count) : freqDict.end();
   using OutIt = std::ostream_iterator< std::string >;
@@ -312,7 +301,7 @@ void kizhin::CommandProcessor::handleBot(const CmdArgs& args) const
   }
   const std::size_t count = args.size() == 2 ? std::stoull(args[1]) : 5;
   FrequencyDictionary dict = loadDictionary(state_[args[0]]);
-  const SizeSet& freqDict = dict.sizeSet;
+  const SizeSet freqDict = rankWords(dict);
   const bool beforeEnd = count < freqDict.size();
   const auto beg = beforeEnd ? std::next(freqDict.rbegin(), count) : freqDict.rend();
   using OutIt = std::ostream_iterator< std::string >;
@@ -336,7 +325,7 @@ void kizhin::CommandProcessor::handleRange(const CmdArgs& args) const
     return;
   }
   const FrequencyDictionary dict = loadDictionary(state_[args[0]]);
-  const SizeSet& freqDict = dict.sizeSet;
+  const SizeSet freqDict = rankWords(dict);
   const auto begin = freqDict.upper_bound({ "", max * dict.total });
   const auto end = freqDict.lower_bound({ "", min * dict.total });
   using std::placeholders::_1;
@@ -25,18 +25,20 @@ void kizhin::expandDictionary(std::istream& in, FrequencyDictionary& dict)
   std::for_each(InIt{ in }, InIt{}, appender);
 }
 
+kizhin::SizeSet kizhin::rankWords(const FrequencyDictionary& dict)
+{
+  return SizeSet(dict.wordMap.begin(), dict.wordMap.end());
+}
+
 void kizhin::appendWord(FrequencyDictionary& dict, const std::string& word)
 {
   WordMap& wordMap = dict.wordMap;
-  WordSet& wordSet = dict.wordSet;
-  SizeSet& sizeSet = dict.sizeSet;
-  if (!wordMap.count(word)) {
-    wordMap[word] = 0;
-    wordSet.insert(word);
+  const auto pos = wordMap.find(word);
+  if (pos != wordMap.end()) {
+    ++pos->second;
+  } else {
+    wordMap.emplace(word, 1);
   }
-  std::size_t& wordCount = wordMap.at(word);
-  sizeSet.erase({ word, wordCount });
-  sizeSet.insert({ word, ++wordCount });
   ++dict.total;
 }
 
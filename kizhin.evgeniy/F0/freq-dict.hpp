@@ -8,7 +8,6 @@
 
 namespace kizhin {
   using WordMap = Map< std::string, std::size_t >;
-  using WordSet = std::set< std::string >;
   using WordAndSize = std::pair< const std::string, std::size_t >;
   struct SizeDescendingComp;
   using SizeSet = std::set< WordAndSize, SizeDescendingComp >;
@@ -21,12 +20,11 @@ namespace kizhin {
   struct FrequencyDictionary
   {
     WordMap wordMap{};
-    WordSet wordSet{};
-    SizeSet sizeSet{};
     std::size_t total = 0;
   };
 
   void expandDictionary(std::istream&, FrequencyDictionary&);
+  SizeSet rankWords(const FrequencyDictionary&);
 }
 
 #endif
@@ -0,0 +1,31 @@
+#include <vector>
+#include <bench.hpp>
+#include <map.hpp>
+
+namespace {
+  using MapT = kizhin::Map< int, int >;
+
+  void runBounds(const char* name, const bench::Options& opts)
+  {
+    const std::vector< int > shuffled = bench::shuffledKeys(opts.n);
+    MapT map;
+    for (int key: shuffled) {
+      map.insert(std::make_pair(key * 2, key));
+    }
+    long long hits = 0;
+    bench::Probe lower(name, "lower_bound");
+    for (int key: shuffled) {
+      hits += map.lowerBound(key * 2 + 1) != map.end();
+    }
+    lower.stop(opts.n);
+    bench::Probe upper(name, "upper_bound");
+    for (int key: shuffled) {
+      hits += map.upperBound(key * 2) != map.end();
+    }
+    upper.stop(opts.n);
+    bench::keep(hits);
+  }
+
+  const bench::Registrar map("kizhin::Map", bench::runMap< MapT >);
+  const bench::Registrar bounds("kizhin::Map<bounds>", runBounds);
+}
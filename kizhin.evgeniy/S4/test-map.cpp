@@ -525,6 +525,27 @@ BOOST_AUTO_TEST_CASE(equal_range)
   BOOST_TEST((res.second == map.end()));
 }
 
+BOOST_AUTO_TEST_CASE(bounds_shuffled_keys)
+{
+  MapT map;
+  std::vector< MapT::key_type > keys(1'500);
+  std::iota(keys.begin(), keys.end(), 0);
+  std::random_device rd;
+  std::mt19937 gen(rd());
+  std::shuffle(keys.begin(), keys.end(), gen);
+  for (const auto& key: keys) {
+    map.insert(std::make_pair(key * 2, ""));
+  }
+  testMapInvariants(map);
+  for (MapT::key_type key = -1; key <= 3'000; ++key) {
+    const auto lower = static_cast< std::ptrdiff_t >((std::max(key, 0) + 1) / 2);
+    const auto upper = static_cast< std::ptrdiff_t >(std::min(std::max(key + 2, 0) / 2, 1'500));
+    BOOST_TEST(std::distance(map.begin(), map.lowerBound(key)) == lower);
+    BOOST_TEST(std::distance(map.begin(), map.upperBound(key)) == upper);
+    BOOST_TEST(map.count(key) == static_cast< std::size_t >(upper - lower));
+  }
+}
+
 BOOST_AUTO_TEST_SUITE_END();
 BOOST_AUTO_TEST_SUITE(comparison_operators);
 
@@ -171,6 +171,8 @@ namespace kizhin {
     std::tuple< Node*, Node* > splitInTwo(const Node*);
     void splitChildren(const Node* src, Node* left, Node* right) const noexcept;
 
+    pointer lowerBoundInNode(const Node*, const key_type&) const;
+    pointer upperBoundInNode(const Node*, const key_type&) const;
     pointer findKey(const Node*, const key_type&) const;
     Node* findTarget(Node*, const key_type&) const;
     Node* validateHint(Node*, const key_type&) const;
@@ -1044,11 +1046,24 @@ template < typename K, typename T, typename C >
 typename kizhin::Map< K, T, C >::const_iterator kizhin::Map< K, T, C >::lowerBound(
     const key_type& key) const
 {
-  auto res = begin();
-  while (res != end() && keyComp()(res->first, key)) {
-    ++res;
-  };
-  return res;
+  const_iterator res = end();
+  if (empty()) {
+    return res;
+  }
+  Node* current = root_;
+  while (true) {
+    pointer valuePtr = lowerBoundInNode(current, key);
+    if (valuePtr != current->end) {
+      res = const_iterator(current, valuePtr);
+      if (!comparator_(key, valuePtr->first)) {
+        return res;
+      }
+    }
+    if (detail::isLeaf(current)) {
+      return res;
+    }
+    current = current->children[valuePtr - current->begin];
+  }
 }
 
 template < typename K, typename T, typename C >
@@ -1064,11 +1079,21 @@ template < typename K, typename T, typename C >
 typename kizhin::Map< K, T, C >::const_iterator kizhin::Map< K, T, C >::upperBound(
     const key_type& key) const
 {
-  auto res = begin();
-  while (res != end() && !keyComp()(key, res->first)) {
-    ++res;
-  };
-  return res;
+  const_iterator res = end();
+  if (empty()) {
+    return res;
+  }
+  Node* current = root_;
+  while (true) {
+    pointer valuePtr = upperBoundInNode(current, key);
+    if (valuePtr != current->end) {
+      res = const_iterator(current, valuePtr);
+    }
+    if (detail::isLeaf(current)) {
+      return res;
+    }
+    current = current->children[valuePtr - current->begin];
+  }
 }
 
 template < typename K, typename T, typename C >
@@ -1228,10 +1253,9 @@ typename kizhin::Map< K, T, C >::Node* kizhin::Map< K, T, C >::eraseFromNode(Nod
 }
 
 template < typename K, typename T, typename C >
-void kizhin::Map< K, T, C >::swapVals(Node* lhs, pointer lhsPtr, Node* rhs,
-    pointer rhsPtr)
+void kizhin::Map< K, T, C >::swapVals(Node*, pointer lhsPtr, Node*, pointer rhsPtr)
 {
-  assert(lhs && lhsPtr && rhs && rhsPtr && "SwapVals: nullptr node given");
+  assert(lhsPtr && rhsPtr && "SwapVals: nullptr value given");
   value_type temp1(*lhsPtr);
   value_type temp2(*rhsPtr);
   lhsPtr->~value_type();
@@ -1300,21 +1324,40 @@ void kizhin::Map< K, T, C >::splitChildren(const Node* src, Node* left,
   std::copy(mid, src->children.end(), right->children.begin());
 }
 
+template < typename K, typename T, typename C >
+typename kizhin::Map< K, T, C >::pointer kizhin::Map< K, T, C >::lowerBoundInNode(
+    const Node* node, const key_type& key) const
+{
+  assert(node && "LowerBoundInNode: nullptr node given");
+  pointer valuePtr = node->begin;
+  while (valuePtr != node->end && comparator_(valuePtr->first, key)) {
+    ++valuePtr;
+  }
+  return valuePtr;
+}
+
+template < typename K, typename T, typename C >
+typename kizhin::Map< K, T, C >::pointer kizhin::Map< K, T, C >::upperBoundInNode(
+    const Node* node, const key_type& key) const
+{
+  assert(node && "UpperBoundInNode: nullptr node given");
+  pointer valuePtr = node->begin;
+  while (valuePtr != node->end && !comparator_(key, valuePtr->first)) {
+    ++valuePtr;
+  }
+  return valuePtr;
+}
+
 template < typename K, typename T, typename C >
 typename kizhin::Map< K, T, C >::pointer kizhin::Map< K, T, C >::findKey(const Node* node,
     const key_type& key) const
 {
   assert(node && "FindKey: nullptr node given");
-  struct KeyEqual
-  {
-    bool operator()(const_reference val) const
-    {
-      return !comp(val.first, key) && !comp(key, val.first);
-    }
-    C comp;
-    const key_type& key;
-  };
-  return std::find_if(node->begin, node->end, KeyEqual{ keyComp(), key });
+  pointer valuePtr = lowerBoundInNode(node, key);
+  if (valuePtr != node->end && comparator_(key, valuePtr->first)) {
+    return node->end;
+  }
+  return valuePtr;
 }
 
 template < typename K, typename T, typename C >
@@ -1323,15 +1366,12 @@ typename kizhin::Map< K, T, C >::Node* kizhin::Map< K, T, C >::findTarget(Node*
 {
   assert(!empty() && "Attempt to find target node in empty tree");
   Node* current = validateHint(hint, key);
-  while (!detail::isLeaf(current) && findKey(current, key) == current->end) {
-    const size_t currSize = detail::size(current);
-    if (comparator_(key, current->begin->first)) {
-      current = current->children[0];
-    } else if (currSize == 1 || comparator_(key, (current->begin + 1)->first)) {
-      current = current->children[1];
-    } else {
-      current = current->children[2];
+  while (!detail::isLeaf(current)) {
+    pointer valuePtr = lowerBoundInNode(current, key);
+    if (valuePtr != current->end && !comparator_(key, valuePtr->first)) {
+      break;
     }
+    current = current->children[valuePtr - current->begin];
   }
   return current;
 }
@@ -0,0 +1,56 @@
+#include <bench.hpp>
+#include <random>
+#include <stdexcept>
+#include <string>
+#include <hash_table/definition.hpp>
+#include <vector/definition.hpp>
+#include "bfs_engine.hpp"
+#include "graph.hpp"
+
+namespace {
+  constexpr size_t width_vertices = 2048;
+
+  maslevtsov::Graph make_graph(size_t vertices)
+  {
+    maslevtsov::Graph graph;
+    std::mt19937 gen(20250101);
+    std::uniform_int_distribution< unsigned > dist(0, static_cast< unsigned >(vertices - 1));
+    for (size_t i = 0; i != vertices * 2; ++i) {
+      try {
+        graph.add_edge(dist(gen), dist(gen));
+      } catch (const std::invalid_argument&) {
+        continue;
+      }
+    }
+    return graph;
+  }
+
+  size_t max_threads()
+  {
+    size_t threads = maslevtsov::hardware_threads();
+    return threads < 4 ? 4 : threads;
+  }
+
+  void run_scaling(const char* name, const bench::Options& opts)
+  {
+    maslevtsov::Graph components_graph = make_graph(opts.n);
+    const maslevtsov::GraphSnapshot& components_snapshot = components_graph.freeze();
+    maslevtsov::Graph width_graph = make_graph(opts.n < width_vertices ? opts.n : width_vertices);
+    const maslevtsov::GraphSnapshot& width_snapshot = width_graph.freeze();
+    for (size_t threads = 1; threads <= max_threads(); threads *= 2) {
+      bench::Probe components(name, "components_t" + std::to_string(threads));
+      maslevtsov::Vector< size_t > roots = maslevtsov::find_components(components_snapshot, threads);
+      components.note("threads", threads);
+      components.stop(components_snapshot.neighbours.size());
+      bench::keep(roots[roots.size() - 1]);
+
+      bench::Probe width(name, "width_t" + std::to_string(threads));
+      size_t result = maslevtsov::find_width(width_snapshot, threads);
+      width.note("threads", threads);
+      width.stop(width_snapshot.vertices.size());
+      bench::keep(result);
+    }
+  }
+
+  const bench::Registrar scaling("maslevtsov::Graph<threads>", run_scaling);
+}
@@ -0,0 +1,6 @@
+#include <bench.hpp>
+#include <hash_table/definition.hpp>
+
+namespace {
+  const bench::Registrar table("maslevtsov::HashTable", bench::runMap< maslevtsov::HashTable< int, int > >);
+}
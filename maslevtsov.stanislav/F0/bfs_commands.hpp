@@ -9,8 +9,8 @@ namespace maslevtsov {
 
   void traverse_breadth_first(const graphs_t& graphs, std::istream& in, std::ostream& out);
   void get_min_path(const graphs_t& graphs, std::istream& in, std::ostream& out);
-  void get_graph_width(const graphs_t& graphs, std::istream& in, std::ostream& out);
-  void get_graph_components(const graphs_t& graphs, std::istream& in, std::ostream& out);
+  void get_graph_width(const graphs_t& graphs, std::istream& in, std::ostream& out, size_t threads);
+  void get_graph_components(const graphs_t& graphs, std::istream& in, std::ostream& out, size_t threads);
 }
 
 #endif
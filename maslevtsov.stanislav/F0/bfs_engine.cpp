@@ -0,0 +1,311 @@
+#include "bfs_engine.hpp"
+#include <atomic>
+#include <exception>
+#include <thread>
+#include <utility>
+#include <vector/definition.hpp>
+
+namespace {
+  using word_t = std::uint64_t;
+  constexpr size_t word_bits = 64;
+  constexpr size_t top_down_ratio = 14;
+  constexpr size_t bottom_up_ratio = 24;
+  constexpr size_t components_chunk = 1024;
+
+  size_t lowest_bit(word_t word) noexcept
+  {
+#if defined(__GNUC__)
+    return __builtin_ctzll(word);
+#else
+    size_t index = 0;
+    while (!(word & 1)) {
+      word >>= 1;
+      ++index;
+    }
+    return index;
+#endif
+  }
+
+  bool test_bit(const maslevtsov::Vector< word_t >& bits, size_t pos) noexcept
+  {
+    return (bits[pos / word_bits] >> (pos % word_bits)) & 1;
+  }
+
+  void set_bit(maslevtsov::Vector< word_t >& bits, size_t pos) noexcept
+  {
+    bits[pos / word_bits] |= word_t(1) << (pos % word_bits);
+  }
+
+  void clear_bits(maslevtsov::Vector< word_t >& bits) noexcept
+  {
+    for (size_t i = 0; i != bits.size(); ++i) {
+      bits[i] = 0;
+    }
+  }
+
+  using roots_t = maslevtsov::Vector< std::atomic< size_t > >;
+
+  size_t find_root(roots_t& roots, size_t vertice) noexcept
+  {
+    size_t parent = roots[vertice].load();
+    while (parent != vertice) {
+      size_t grandparent = roots[parent].load();
+      roots[vertice].compare_exchange_weak(parent, grandparent);
+      vertice = grandparent;
+      parent = roots[vertice].load();
+    }
+    return vertice;
+  }
+
+  void unite(roots_t& roots, size_t vertice1, size_t vertice2) noexcept
+  {
+    while (true) {
+      size_t root1 = find_root(roots, vertice1);
+      size_t root2 = find_root(roots, vertice2);
+      if (root1 == root2) {
+        return;
+      }
+      if (root1 > root2) {
+        std::swap(root1, root2);
+      }
+      if (roots[root2].compare_exchange_strong(root2, root1)) {
+        return;
+      }
+    }
+  }
+
+  template< class F >
+  void run_parallel(size_t threads, F worker)
+  {
+    maslevtsov::Vector< std::exception_ptr > errors(threads);
+    auto guarded = [&errors, &worker](size_t index)
+    {
+      try {
+        worker();
+      } catch (...) {
+        errors[index] = std::current_exception();
+      }
+    };
+    maslevtsov::Vector< std::thread > pool(threads - 1);
+    size_t started = 0;
+    try {
+      for (; started != pool.size(); ++started) {
+        pool[started] = std::thread(guarded, started + 1);
+      }
+    } catch (...) {
+      errors[started + 1] = std::current_exception();
+    }
+    guarded(0);
+    for (size_t i = 0; i != started; ++i) {
+      pool[i].join();
+    }
+    for (size_t i = 0; i != errors.size(); ++i) {
+      if (errors[i]) {
+        std::rethrow_exception(errors[i]);
+      }
+    }
+  }
+
+  size_t limit_threads(size_t threads, size_t work) noexcept
+  {
+    if (threads > work) {
+      threads = work;
+    }
+    return threads == 0 ? 1 : threads;
+  }
+}
+
+maslevtsov::BfsEngine::BfsEngine(const GraphSnapshot& snapshot):
+  snapshot_(snapshot),
+  visited_((snapshot.vertices.size() + word_bits - 1) / word_bits),
+  frontier_(visited_.size()),
+  next_(visited_.size()),
+  order_(snapshot.vertices.size()),
+  distances_(snapshot.vertices.size()),
+  parents_(snapshot.vertices.size()),
+  reached_(0)
+{}
+
+void maslevtsov::BfsEngine::run_ordered(size_t start)
+{
+  clear_bits(visited_);
+  set_bit(visited_, start);
+  order_[0] = start;
+  distances_[start] = 0;
+  reached_ = 1;
+  for (size_t head = 0; head != reached_; ++head) {
+    size_t current_node = order_[head];
+    size_t next_distance = distances_[current_node] + 1;
+    for (size_t i = snapshot_.offsets[current_node]; i != snapshot_.offsets[current_node + 1]; ++i) {
+      size_t neighbour = snapshot_.neighbours[i];
+      if (!test_bit(visited_, neighbour)) {
+        set_bit(visited_, neighbour);
+        distances_[neighbour] = next_distance;
+        parents_[neighbour] = current_node;
+        order_[reached_++] = neighbour;
+      }
+    }
+  }
+}
+
+size_t maslevtsov::BfsEngine::run_levels(size_t start)
+{
+  clear_bits(visited_);
+  clear_bits(frontier_);
+  set_bit(visited_, start);
+  set_bit(frontier_, start);
+  size_t frontier_size = 1, frontier_edges = degree(start);
+  size_t unexplored_edges = snapshot_.neighbours.size() - frontier_edges;
+  size_t level = 0;
+  bool is_bottom_up = false;
+  reached_ = 1;
+  while (true) {
+    if (!is_bottom_up && frontier_edges * top_down_ratio > unexplored_edges) {
+      is_bottom_up = true;
+    } else if (is_bottom_up && frontier_size * bottom_up_ratio < snapshot_.vertices.size()) {
+      is_bottom_up = false;
+    }
+    clear_bits(next_);
+    size_t next_size = 0, next_edges = 0;
+    if (is_bottom_up) {
+      step_bottom_up(next_size, next_edges);
+    } else {
+      step_top_down(next_size, next_edges);
+    }
+    if (next_size == 0) {
+      return level;
+    }
+    ++level;
+    reached_ += next_size;
+    unexplored_edges -= next_edges;
+    frontier_.swap(next_);
+    frontier_size = next_size;
+    frontier_edges = next_edges;
+  }
+}
+
+void maslevtsov::BfsEngine::step_top_down(size_t& next_size, size_t& next_edges)
+{
+  for (size_t w = 0; w != frontier_.size(); ++w) {
+    for (word_t word = frontier_[w]; word != 0; word &= word - 1) {
+      size_t current_node = w * word_bits + lowest_bit(word);
+      for (size_t i = snapshot_.offsets[current_node]; i != snapshot_.offsets[current_node + 1]; ++i) {
+        size_t neighbour = snapshot_.neighbours[i];
+        if (!test_bit(visited_, neighbour)) {
+          set_bit(visited_, neighbour);
+          set_bit(next_, neighbour);
+          ++next_size;
+          next_edges += degree(neighbour);
+        }
+      }
+    }
+  }
+}
+
+void maslevtsov::BfsEngine::step_bottom_up(size_t& next_size, size_t& next_edges)
+{
+  size_t vertice_count = snapshot_.vertices.size();
+  for (size_t w = 0; w != visited_.size(); ++w) {
+    word_t unvisited = ~visited_[w];
+    if (w == visited_.size() - 1 && vertice_count % word_bits != 0) {
+      unvisited &= (word_t(1) << (vertice_count % word_bits)) - 1;
+    }
+    for (; unvisited != 0; unvisited &= unvisited - 1) {
+      size_t current_node = w * word_bits + lowest_bit(unvisited);
+      for (size_t i = snapshot_.offsets[current_node]; i != snapshot_.offsets[current_node + 1]; ++i) {
+        if (test_bit(frontier_, snapshot_.neighbours[i])) {
+          set_bit(visited_, current_node);
+          set_bit(next_, current_node);
+          ++next_size;
+          next_edges += degree(current_node);
+          break;
+        }
+      }
+    }
+  }
+}
+
+size_t maslevtsov::BfsEngine::reached() const noexcept
+{
+  return reached_;
+}
+
+size_t maslevtsov::BfsEngine::order(size_t pos) const noexcept
+{
+  return order_[pos];
+}
+
+size_t maslevtsov::BfsEngine::distance(size_t vertice) const noexcept
+{
+  return distances_[vertice];
+}
+
+size_t maslevtsov::BfsEngine::parent(size_t vertice) const noexcept
+{
+  return parents_[vertice];
+}
+
+bool maslevtsov::BfsEngine::is_reached(size_t vertice) const noexcept
+{
+  return test_bit(visited_, vertice);
+}
+
+size_t maslevtsov::BfsEngine::degree(size_t vertice) const noexcept
+{
+  return snapshot_.offsets[vertice + 1] - snapshot_.offsets[vertice];
+}
+
+size_t maslevtsov::hardware_threads() noexcept
+{
+  unsigned threads = std::thread::hardware_concurrency();
+  return threads == 0 ? 1 : threads;
+}
+
+size_t maslevtsov::find_width(const GraphSnapshot& snapshot, size_t threads)
+{
+  size_t vertice_count = snapshot.vertices.size();
+  std::atomic< size_t > next_source(0);
+  std::atomic< size_t > max_distance(0);
+  run_parallel(limit_threads(threads, vertice_count), [&]()
+  {
+    BfsEngine engine(snapshot);
+    size_t local_max = 0;
+    for (size_t i = next_source++; i < vertice_count; i = next_source++) {
+      size_t distance = engine.run_levels(i);
+      if (local_max < distance) {
+        local_max = distance;
+      }
+    }
+    size_t current = max_distance.load();
+    while (current < local_max && !max_distance.compare_exchange_weak(current, local_max)) {
+    }
+  });
+  return max_distance.load();
+}
+
+maslevtsov::Vector< size_t > maslevtsov::find_components(const GraphSnapshot& snapshot, size_t threads)
+{
+  size_t vertice_count = snapshot.vertices.size();
+  roots_t roots(vertice_count);
+  for (size_t i = 0; i != vertice_count; ++i) {
+    roots[i].store(i);
+  }
+  size_t chunks = (vertice_count + components_chunk - 1) / components_chunk;
+  std::atomic< size_t > next_chunk(0);
+  run_parallel(limit_threads(threads, chunks), [&]()
+  {
+    for (size_t chunk = next_chunk++; chunk < chunks; chunk = next_chunk++) {
+      size_t last = (chunk + 1) * components_chunk < vertice_count ? (chunk + 1) * components_chunk : vertice_count;
+      for (size_t vertice = chunk * components_chunk; vertice != last; ++vertice) {
+        for (size_t i = snapshot.offsets[vertice]; i != snapshot.offsets[vertice + 1]; ++i) {
+          unite(roots, vertice, snapshot.neighbours[i]);
+        }
+      }
+    }
+  });
+  maslevtsov::Vector< size_t > result(vertice_count);
+  for (size_t i = 0; i != vertice_count; ++i) {
+    result[i] = find_root(roots, i);
+  }
+  return result;
+}
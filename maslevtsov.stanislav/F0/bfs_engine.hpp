@@ -0,0 +1,45 @@
+#ifndef BFS_ENGINE_HPP
+#define BFS_ENGINE_HPP
+
+#include <cstdint>
+#include <vector/declaration.hpp>
+#include "graph.hpp"
+
+namespace maslevtsov {
+  class BfsEngine
+  {
+  public:
+    explicit BfsEngine(const GraphSnapshot& snapshot);
+
+    void run_ordered(size_t start);
+    size_t run_levels(size_t start);
+
+    size_t reached() const noexcept;
+    size_t order(size_t pos) const noexcept;
+    size_t distance(size_t vertice) const noexcept;
+    size_t parent(size_t vertice) const noexcept;
+    bool is_reached(size_t vertice) const noexcept;
+
+  private:
+    using bitset_t = maslevtsov::Vector< std::uint64_t >;
+
+    const GraphSnapshot& snapshot_;
+    bitset_t visited_;
+    bitset_t frontier_;
+    bitset_t next_;
+    maslevtsov::Vector< size_t > order_;
+    maslevtsov::Vector< size_t > distances_;
+    maslevtsov::Vector< size_t > parents_;
+    size_t reached_;
+
+    size_t degree(size_t vertice) const noexcept;
+    void step_top_down(size_t& next_size, size_t& next_edges);
+    void step_bottom_up(size_t& next_size, size_t& next_edges);
+  };
+
+  size_t hardware_threads() noexcept;
+  size_t find_width(const GraphSnapshot& snapshot, size_t threads);
+  maslevtsov::Vector< size_t > find_components(const GraphSnapshot& snapshot, size_t threads);
+}
+
+#endif
@@ -80,8 +80,36 @@ const maslevtsov::Graph::adjacency_list_t& maslevtsov::Graph::get_adj_list() con
   return adjacency_list_;
 }
 
+const maslevtsov::GraphSnapshot& maslevtsov::Graph::freeze() const
+{
+  if (is_frozen_) {
+    return snapshot_;
+  }
+  GraphSnapshot result;
+  result.vertices = maslevtsov::Vector< unsigned >(adjacency_list_.size());
+  result.offsets = maslevtsov::Vector< size_t >(adjacency_list_.size() + 1);
+  size_t id = 0, edge_count = 0;
+  for (auto i = adjacency_list_.cbegin(); i != adjacency_list_.cend(); ++i, ++id) {
+    result.vertices[id] = i->first;
+    result.ids[i->first] = id;
+    edge_count += i->second.size();
+    result.offsets[id + 1] = edge_count;
+  }
+  result.neighbours = maslevtsov::Vector< size_t >(edge_count);
+  size_t pos = 0;
+  for (auto i = adjacency_list_.cbegin(); i != adjacency_list_.cend(); ++i) {
+    for (auto j = i->second.cbegin(); j != i->second.cend(); ++j) {
+      result.neighbours[pos++] = result.ids.at(*j);
+    }
+  }
+  snapshot_ = std::move(result);
+  is_frozen_ = true;
+  return snapshot_;
+}
+
 void maslevtsov::Graph::add_vertice(unsigned vertice)
 {
+  is_frozen_ = false;
   if (adjacency_list_.find(vertice) != adjacency_list_.end()) {
     throw std::invalid_argument("vertice already exist");
   }
@@ -90,6 +118,7 @@ void maslevtsov::Graph::add_vertice(unsigned vertice)
 
 void maslevtsov::Graph::add_edge(unsigned vertice1, unsigned vertice2)
 {
+  is_frozen_ = false;
   auto vertice1_it = adjacency_list_.find(vertice1);
   if (vertice1_it != adjacency_list_.end()) {
     if (find_neighbour(vertice1_it->second, vertice2) != vertice1_it->second.cend()) {
@@ -102,6 +131,7 @@ void maslevtsov::Graph::add_edge(unsigned vertice1, unsigned vertice2)
 
 void maslevtsov::Graph::delete_vertice(unsigned vertice)
 {
+  is_frozen_ = false;
   if (adjacency_list_.find(vertice) == adjacency_list_.end()) {
     throw std::invalid_argument("non-existing vertice");
   }
@@ -115,6 +145,7 @@ void maslevtsov::Graph::delete_vertice(unsigned vertice)
 
 void maslevtsov::Graph::delete_edge(unsigned vertice1, unsigned vertice2)
 {
+  is_frozen_ = false;
   auto vertice1_it = adjacency_list_.find(vertice1);
   if (vertice1_it == adjacency_list_.end()) {
     throw std::invalid_argument("non-existing edge");
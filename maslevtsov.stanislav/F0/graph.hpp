@@ -6,6 +6,14 @@
 #include <vector/declaration.hpp>
 
 namespace maslevtsov {
+  struct GraphSnapshot
+  {
+    maslevtsov::Vector< unsigned > vertices;
+    maslevtsov::HashTable< unsigned, size_t > ids;
+    maslevtsov::Vector< size_t > offsets;
+    maslevtsov::Vector< size_t > neighbours;
+  };
+
   class Graph
   {
   public:
@@ -16,6 +24,7 @@ namespace maslevtsov {
     Graph(const Graph& src, const maslevtsov::Vector< unsigned >& vertices);
 
     const adjacency_list_t& get_adj_list() const;
+    const GraphSnapshot& freeze() const;
 
     void add_vertice(unsigned vertice);
     void add_edge(unsigned vertice1, unsigned vertice2);
@@ -24,6 +33,8 @@ namespace maslevtsov {
 
   private:
     adjacency_list_t adjacency_list_;
+    mutable GraphSnapshot snapshot_;
+    mutable bool is_frozen_ = false;
 
     friend std::istream& operator>>(std::istream& in, Graph& gr);
     friend std::ostream& operator<<(std::ostream& out, const Graph& gr);
@@ -24,7 +24,9 @@ void maslevtsov::print_help_manual(std::ostream& out)
   out << "program [OPTION]... [FILE]...\n";
   out << "Launching the program with loading graphs from the [FILE]\n";
   out << "Options: --help - help output\n";
-  out << "         --check - check graphs foramt in [FILE]\n\n";
+  out << "         --check - check graphs foramt in [FILE]\n";
+  out << "Environment: GRAPH_THREADS - number of threads for width and components,\n";
+  out << "             defaults to the number of hardware threads\n\n";
   out << "GRAPHS FORMAT:\n";
   out << "<graph_name>\n<vertices_number>\n<vertice1>: <vertice2>...\n<vertice2>: <vertice1>...\n...\n";
   out << "Vertices of the graph are numbered with an unsigned integer, starting from zero.\n\n";
@@ -1,11 +1,28 @@
 #include <fstream>
+#include <cstdlib>
 #include <cstring>
 #include <functional>
 #include <limits>
 #include <hash_table/definition.hpp>
 #include "bfs_commands.hpp"
+#include "bfs_engine.hpp"
 #include "graph_commands.hpp"
 
+namespace {
+  size_t get_threads_count()
+  {
+    const char* value = std::getenv("GRAPH_THREADS");
+    if (value != nullptr) {
+      char* end = nullptr;
+      unsigned long threads = std::strtoul(value, &end, 10);
+      if (end != value && *end == '\0' && threads != 0) {
+        return threads;
+      }
+    }
+    return maslevtsov::hardware_threads();
+  }
+}
+
 int main(int argc, char** argv)
 {
   using namespace maslevtsov;
@@ -61,8 +78,10 @@ int main(int argc, char** argv)
 
   commands["bfs"] = std::bind(traverse_breadth_first, std::cref(graphs), std::ref(std::cin), std::ref(std::cout));
   commands["path"] = std::bind(get_min_path, std::cref(graphs), std::ref(std::cin), std::ref(std::cout));
-  commands["width"] = std::bind(get_graph_width, std::cref(graphs), std::ref(std::cin), std::ref(std::cout));
-  commands["components"] = std::bind(get_graph_components, std::cref(graphs), std::ref(std::cin), std::ref(std::cout));
+  size_t threads = get_threads_count();
+  commands["width"] = std::bind(get_graph_width, std::cref(graphs), std::ref(std::cin), std::ref(std::cout), threads);
+  commands["components"] =
+    std::bind(get_graph_components, std::cref(graphs), std::ref(std::cin), std::ref(std::cout), threads);
 
   std::string command;
   while ((std::cin >> command) && !std::cin.eof()) {
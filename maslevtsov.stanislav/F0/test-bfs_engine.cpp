@@ -0,0 +1,169 @@
+#include <boost/test/unit_test.hpp>
+#include <random>
+#include <stdexcept>
+#include <vector>
+#include <hash_table/definition.hpp>
+#include <vector/definition.hpp>
+#include "bfs_engine.hpp"
+
+namespace {
+  constexpr size_t unreached = static_cast< size_t >(-1);
+
+  maslevtsov::Graph make_graph(unsigned vertices, size_t edges, unsigned seed)
+  {
+    maslevtsov::Graph graph;
+    for (unsigned i = 0; i != vertices; ++i) {
+      graph.add_vertice(i);
+    }
+    if (vertices < 2) {
+      return graph;
+    }
+    std::mt19937 gen(seed);
+    std::uniform_int_distribution< unsigned > dist(0, vertices - 1);
+    for (size_t i = 0; i != edges; ++i) {
+      unsigned from = dist(gen);
+      unsigned to = dist(gen);
+      if (from == to) {
+        continue;
+      }
+      try {
+        graph.add_edge(from, to);
+      } catch (const std::invalid_argument&) {
+        continue;
+      }
+    }
+    return graph;
+  }
+
+  maslevtsov::Graph make_star(unsigned vertices)
+  {
+    maslevtsov::Graph graph;
+    for (unsigned i = 1; i < vertices; ++i) {
+      graph.add_edge(0, i);
+    }
+    return graph;
+  }
+
+  struct ReferenceBfs
+  {
+    std::vector< size_t > order;
+    std::vector< size_t > distances;
+    std::vector< size_t > parents;
+  };
+
+  ReferenceBfs plain_bfs(const maslevtsov::GraphSnapshot& snapshot, size_t start)
+  {
+    ReferenceBfs result;
+    result.distances.assign(snapshot.vertices.size(), unreached);
+    result.parents.assign(snapshot.vertices.size(), unreached);
+    result.distances[start] = 0;
+    result.order.push_back(start);
+    for (size_t head = 0; head != result.order.size(); ++head) {
+      size_t current = result.order[head];
+      for (size_t i = snapshot.offsets[current]; i != snapshot.offsets[current + 1]; ++i) {
+        size_t neighbour = snapshot.neighbours[i];
+        if (result.distances[neighbour] == unreached) {
+          result.distances[neighbour] = result.distances[current] + 1;
+          result.parents[neighbour] = current;
+          result.order.push_back(neighbour);
+        }
+      }
+    }
+    return result;
+  }
+
+  size_t eccentricity(const ReferenceBfs& bfs)
+  {
+    return bfs.distances[bfs.order.back()];
+  }
+
+  void check_engine(const maslevtsov::GraphSnapshot& snapshot)
+  {
+    maslevtsov::BfsEngine engine(snapshot);
+    for (size_t start = 0; start != snapshot.vertices.size(); ++start) {
+      ReferenceBfs expected = plain_bfs(snapshot, start);
+
+      BOOST_TEST(engine.run_levels(start) == eccentricity(expected));
+      BOOST_TEST(engine.reached() == expected.order.size());
+      for (size_t i = 0; i != snapshot.vertices.size(); ++i) {
+        BOOST_TEST(engine.is_reached(i) == (expected.distances[i] != unreached));
+      }
+
+      engine.run_ordered(start);
+      BOOST_TEST(engine.reached() == expected.order.size());
+      for (size_t i = 0; i != expected.order.size(); ++i) {
+        size_t vertice = expected.order[i];
+        BOOST_TEST(engine.order(i) == vertice);
+        BOOST_TEST(engine.distance(vertice) == expected.distances[vertice]);
+        if (vertice != start) {
+          BOOST_TEST(engine.parent(vertice) == expected.parents[vertice]);
+        }
+      }
+    }
+  }
+}
+
+BOOST_AUTO_TEST_SUITE(bfs_engine_tests)
+BOOST_AUTO_TEST_CASE(sparse_graphs_test)
+{
+  const unsigned sizes[] = {1, 2, 63, 64, 65, 200};
+  for (unsigned vertices: sizes) {
+    maslevtsov::Graph graph = make_graph(vertices, vertices, vertices);
+    check_engine(graph.freeze());
+  }
+}
+
+BOOST_AUTO_TEST_CASE(dense_graphs_test)
+{
+  const unsigned sizes[] = {65, 127, 200};
+  for (unsigned vertices: sizes) {
+    maslevtsov::Graph graph = make_graph(vertices, vertices * vertices / 4, vertices + 1);
+    check_engine(graph.freeze());
+  }
+}
+
+BOOST_AUTO_TEST_CASE(star_graph_test)
+{
+  maslevtsov::Graph graph = make_star(130);
+  graph.add_edge(129, 1000);
+  graph.add_edge(1000, 1001);
+  check_engine(graph.freeze());
+}
+BOOST_AUTO_TEST_SUITE_END()
+
+BOOST_AUTO_TEST_SUITE(parallel_tests)
+BOOST_AUTO_TEST_CASE(threads_match_sequential_test)
+{
+  const size_t threads[] = {1, 2, 4, 7};
+  const unsigned sizes[] = {1, 300, 3000};
+  for (unsigned vertices: sizes) {
+    maslevtsov::Graph graph = make_graph(vertices, vertices / 2 + vertices / 8, vertices + 2);
+    const maslevtsov::GraphSnapshot& snapshot = graph.freeze();
+
+    size_t width = 0;
+    std::vector< size_t > smallest(vertices, unreached);
+    for (size_t start = 0; start != vertices; ++start) {
+      ReferenceBfs expected = plain_bfs(snapshot, start);
+      if (width < eccentricity(expected)) {
+        width = eccentricity(expected);
+      }
+      if (smallest[start] == unreached) {
+        for (size_t vertice: expected.order) {
+          smallest[vertice] = start;
+        }
+      }
+    }
+
+    maslevtsov::Vector< size_t > sequential = maslevtsov::find_components(snapshot, 1);
+    for (size_t count: threads) {
+      BOOST_TEST(maslevtsov::find_width(snapshot, count) == width);
+      maslevtsov::Vector< size_t > roots = maslevtsov::find_components(snapshot, count);
+      BOOST_TEST(roots.size() == vertices);
+      for (size_t i = 0; i != roots.size(); ++i) {
+        BOOST_TEST(roots[i] == smallest[i]);
+        BOOST_TEST(roots[i] == sequential[i]);
+      }
+    }
+  }
+}
+BOOST_AUTO_TEST_SUITE_END()
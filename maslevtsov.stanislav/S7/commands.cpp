@@ -82,6 +82,13 @@ void maslevtsov::print_inbound(const graphs_map_t& graphs, std::istream& in, std
   }
 }
 
+void maslevtsov::print_stats(const graphs_map_t& graphs, std::istream& in, std::ostream& out)
+{
+  std::string graph_name;
+  in >> graph_name;
+  out << graphs.at(graph_name).get_edges_stats() << '\n';
+}
+
 void maslevtsov::bind_vertices(graphs_map_t& graphs, std::istream& in)
 {
   std::string graph_name, vertice1, vertice2;
@@ -12,6 +12,7 @@ namespace maslevtsov {
   void print_vertices(const graphs_map_t& graphs, std::istream& in, std::ostream& out);
   void print_outbound(const graphs_map_t& graphs, std::istream& in, std::ostream& out);
   void print_inbound(const graphs_map_t& graphs, std::istream& in, std::ostream& out);
+  void print_stats(const graphs_map_t& graphs, std::istream& in, std::ostream& out);
   void bind_vertices(graphs_map_t& graphs, std::istream& in);
   void cut_vertices(graphs_map_t& graphs, std::istream& in);
   void create_graph(graphs_map_t& graphs, std::istream& in);
@@ -148,3 +148,8 @@ void maslevtsov::Graph::cut(const std::string& vertice1, const std::string& vert
     throw std::invalid_argument("non-existing weight given");
   }
 }
+
+maslevtsov::HashTableStats maslevtsov::Graph::get_edges_stats() const
+{
+  return edges_set_.stats();
+}
@@ -26,6 +26,7 @@ namespace maslevtsov {
     bool check_vertice_existence(const std::string& vertice);
     void add_vertice(const std::string& vertice);
     void cut(const std::string& vertice1, const std::string& vertice2, unsigned weight);
+    HashTableStats get_edges_stats() const;
 
   private:
     edges_set_t edges_set_;
@@ -40,6 +40,7 @@ int main(int argc, char** argv)
   commands["vertexes"] = IOFuncBinder< graphs_map_t >(print_vertices, graphs, std::cin, std::cout);
   commands["outbound"] = IOFuncBinder< graphs_map_t >(print_outbound, graphs, std::cin, std::cout);
   commands["inbound"] = IOFuncBinder< graphs_map_t >(print_inbound, graphs, std::cin, std::cout);
+  commands["stats"] = IOFuncBinder< graphs_map_t >(print_stats, graphs, std::cin, std::cout);
   commands["bind"] = IOFuncBinder< graphs_map_t >(bind_vertices, graphs, std::cin);
   commands["cut"] = IOFuncBinder< graphs_map_t >(cut_vertices, graphs, std::cin);
   commands["create"] = IOFuncBinder< graphs_map_t >(create_graph, graphs, std::cin);
@@ -216,4 +216,43 @@ BOOST_AUTO_TEST_CASE(rehash_test)
   table.rehash(62);
   BOOST_TEST(table.load_factor() == 0.0625);
 }
+
+BOOST_AUTO_TEST_CASE(colliding_rehash_test)
+{
+  maslevtsov::HashTable< int, int > table;
+  for (int i = 0; i != 2000; ++i) {
+    table[i * 7919 % 100003] = i;
+  }
+  for (int i = 0; i != 2000; ++i) {
+    BOOST_TEST(table.at(i * 7919 % 100003) == i);
+  }
+}
+
+BOOST_AUTO_TEST_CASE(stats_test)
+{
+  maslevtsov::HashTable< int, int > table;
+  maslevtsov::HashTableStats empty = table.stats();
+  BOOST_TEST(empty.size == 0);
+  BOOST_TEST(empty.capacity == 16);
+  BOOST_TEST(empty.rehashes == 0);
+  BOOST_TEST(empty.occupancy.size() == 16);
+  for (int i = 0; i != 100; ++i) {
+    table[i] = i;
+  }
+  for (int i = 0; i != 30; ++i) {
+    table.erase(i);
+  }
+  maslevtsov::HashTableStats result = table.stats();
+  BOOST_TEST(result.size == 70);
+  BOOST_TEST(result.capacity == 128);
+  BOOST_TEST(result.tombstones == 30);
+  BOOST_TEST(result.rehashes == 3);
+  BOOST_TEST(result.max_probe == 1);
+  BOOST_TEST(result.avg_probe == 1.0);
+  size_t occupied = 0;
+  for (size_t i = 0; i != result.occupancy.size(); ++i) {
+    occupied += result.occupancy[i];
+  }
+  BOOST_TEST(occupied == 70);
+}
 BOOST_AUTO_TEST_SUITE_END()
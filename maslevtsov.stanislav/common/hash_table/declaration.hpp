@@ -6,6 +6,7 @@
 #include <vector/declaration.hpp>
 #include "hash_table_iterator.hpp"
 #include "slot.hpp"
+#include "stats.hpp"
 
 namespace maslevtsov {
   template< class Key, class T, class Hash = std::hash< Key >, class ProbeHash = std::hash< Key >,
@@ -60,6 +61,7 @@ namespace maslevtsov {
     float max_load_factor() const noexcept;
     void max_load_factor(float ml);
     void rehash(size_type count);
+    HashTableStats stats() const;
 
   private:
     friend class HashTableIterator< Key, T, Hash, ProbeHash, KeyEqual, detail::HashTableIteratorType::CONSTANT >;
@@ -71,8 +73,10 @@ namespace maslevtsov {
     ProbeHash probe_hasher_;
     KeyEqual key_equal_;
     float max_load_factor_ = 1.0;
+    size_type rehashes_ = 0;
 
     size_type find_index(const Key& key) const noexcept;
+    size_type probe_length(size_type index) const noexcept;
   };
 }
 
@@ -1,6 +1,7 @@
 #ifndef HASH_TABLE_DEFINITION_HPP
 #define HASH_TABLE_DEFINITION_HPP
 
+#include <algorithm>
 #include <utility>
 #include <vector/definition.hpp>
 #include "declaration.hpp"
@@ -278,6 +279,8 @@ void maslevtsov::HashTable< Key, T, Hash, ProbeHash, KeyEqual >::swap(HashTable&
   std::swap(hasher_, other.hasher_);
   std::swap(probe_hasher_, other.probe_hasher_);
   std::swap(key_equal_, other.key_equal_);
+  std::swap(max_load_factor_, other.max_load_factor_);
+  std::swap(rehashes_, other.rehashes_);
 }
 
 template< class Key, class T, class Hash, class ProbeHash, class KeyEqual >
@@ -319,14 +322,37 @@ void maslevtsov::HashTable< Key, T, Hash, ProbeHash, KeyEqual >::rehash(size_typ
     if (it->state == detail::SlotState::OCCUPIED) {
       const Key& key = it->data.first;
       size_t index = hasher_(key) % new_slots.size();
-      size_t odd_step = detail::get_odd_step(key, slots_.size(), probe_hasher_);
+      size_t odd_step = detail::get_odd_step(key, new_slots.size(), probe_hasher_);
       while (new_slots[index].state == detail::SlotState::OCCUPIED) {
         index = (index + odd_step) % new_slots.size();
       }
       new_slots[index] = *it;
     }
   }
-  slots_ = new_slots;
+  slots_ = std::move(new_slots);
+  ++rehashes_;
+}
+
+template< class Key, class T, class Hash, class ProbeHash, class KeyEqual >
+maslevtsov::HashTableStats maslevtsov::HashTable< Key, T, Hash, ProbeHash, KeyEqual >::stats() const
+{
+  size_t groups = std::min< size_t >(16, slots_.size());
+  HashTableStats result{size_, slots_.size(), 0, rehashes_, 0, 0.0, Vector< size_t >(groups)};
+  size_t total_probe = 0;
+  for (size_t i = 0; i != slots_.size(); ++i) {
+    if (slots_[i].state == detail::SlotState::DELETED) {
+      ++result.tombstones;
+    } else if (slots_[i].state == detail::SlotState::OCCUPIED) {
+      size_t probe = probe_length(i);
+      total_probe += probe;
+      result.max_probe = std::max(result.max_probe, probe);
+      ++result.occupancy[i * groups / slots_.size()];
+    }
+  }
+  if (size_ != 0) {
+    result.avg_probe = static_cast< double >(total_probe) / size_;
+  }
+  return result;
 }
 
 template< class Key, class T, class Hash, class ProbeHash, class KeyEqual >
@@ -347,4 +373,19 @@ typename maslevtsov::HashTable< Key, T, Hash, ProbeHash, KeyEqual >::size_type
   return slots_.size();
 }
 
+template< class Key, class T, class Hash, class ProbeHash, class KeyEqual >
+typename maslevtsov::HashTable< Key, T, Hash, ProbeHash, KeyEqual >::size_type
+  maslevtsov::HashTable< Key, T, Hash, ProbeHash, KeyEqual >::probe_length(size_type index) const noexcept
+{
+  const Key& key = slots_[index].data.first;
+  size_t current = hasher_(key) % slots_.size();
+  size_t odd_step = detail::get_odd_step(key, slots_.size(), probe_hasher_);
+  size_t length = 1;
+  while (current != index && length < slots_.size()) {
+    current = (current + odd_step) % slots_.size();
+    ++length;
+  }
+  return length;
+}
+
 #endif
@@ -0,0 +1,35 @@
+#ifndef HASH_TABLE_STATS_HPP
+#define HASH_TABLE_STATS_HPP
+
+#include <cstddef>
+#include <ostream>
+#include <vector/definition.hpp>
+
+namespace maslevtsov {
+  struct HashTableStats
+  {
+    std::size_t size;
+    std::size_t capacity;
+    std::size_t tombstones;
+    std::size_t rehashes;
+    std::size_t max_probe;
+    double avg_probe;
+    Vector< std::size_t > occupancy;
+  };
+
+  inline std::ostream& operator<<(std::ostream& out, const HashTableStats& stats)
+  {
+    std::ostream::sentry sentry(out);
+    if (!sentry) {
+      return out;
+    }
+    out << stats.size << '/' << stats.capacity << " slots, " << stats.tombstones << " tombstones, ";
+    out << stats.rehashes << " rehashes, probe " << stats.avg_probe << '/' << stats.max_probe << ", occupancy";
+    for (auto i = stats.occupancy.cbegin(); i != stats.occupancy.cend(); ++i) {
+      out << ' ' << *i;
+    }
+    return out;
+  }
+}
+
+#endif
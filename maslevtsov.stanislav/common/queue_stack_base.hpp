@@ -158,7 +158,8 @@ namespace maslevtsov {
     if (size_ == capacity_) {
       expand_data(size_ * 2 + 1);
     }
-    data_[size_++] = std::forward< U >(value);
+    data_[is_pop_front ? (first_ + size_) % capacity_ : size_] = std::forward< U >(value);
+    ++size_;
   }
 
   template< class T, bool is_pop_front >
@@ -3,6 +3,8 @@
 #include <string>
 #include <numeric>
 #include <iomanip>
+#include <algorithm>
+#include <memory>
 
 namespace
 {
@@ -25,56 +27,58 @@ namespace
     void operator()(constWord & word) const
     {
       out << std::left << std::setw(width) << word.first;
-      for (size_t i = 0; i < word.second.size(); ++i)
+      for (auto it = word.second.cbegin(); it != word.second.cend(); ++it)
       {
-        PrintWordPos{out}(word.second[i]);
+        PrintWordPos{out}(*it);
       }
       out << '\n';
     }
   };
 
-  void bubbleSort(mozhegova::DynamicArray< std::pair< mozhegova::WordPos, std::string > > & arr)
+  using PlacedWord = std::pair< mozhegova::WordPos, const std::string * >;
+
+  void countingSort(const mozhegova::DynamicArray< PlacedWord > & from, mozhegova::DynamicArray< PlacedWord > & to,
+    size_t maxKey, bool byLine)
   {
-    size_t n = arr.size();
-    for (size_t i = 0; i < n - 1; i++)
+    mozhegova::DynamicArray< size_t > starts(maxKey + 2);
+    for (size_t i = 0; i < from.size(); ++i)
     {
-      bool swapped = false;
-      for (size_t j = 0; j < n - i - 1; j++)
-      {
-        if (arr[j].first > arr[j + 1].first)
-        {
-          std::pair< mozhegova::WordPos, std::string > temp = arr[j];
-          arr[j] = arr[j + 1];
-          arr[j + 1] = temp;
-          swapped = true;
-        }
-      }
-      if (swapped == false)
-      {
-        break;
-      }
+      ++starts[(byLine ? from[i].first.first : from[i].first.second) + 1];
+    }
+    for (size_t key = 1; key < maxKey + 2; ++key)
+    {
+      starts[key] += starts[key - 1];
+    }
+    for (size_t i = 0; i < from.size(); ++i)
+    {
+      to[starts[byLine ? from[i].first.first : from[i].first.second]++] = from[i];
     }
   }
 
   std::string reconstructText(const mozhegova::Text & text)
   {
-    mozhegova::DynamicArray< std::pair< mozhegova::WordPos, std::string > > sortedWords;
+    mozhegova::DynamicArray< PlacedWord > sortedWords;
+    size_t maxLine = 0, maxNum = 0;
     for (auto it1 = text.cbegin(); it1 != text.cend(); ++it1)
     {
-      for (size_t i = 0; i < it1->second.size(); ++i)
+      for (auto it2 = it1->second.cbegin(); it2 != it1->second.cend(); ++it2)
       {
-        sortedWords.push_back({it1->second[i], it1->first});
+        sortedWords.push_back({*it2, std::addressof(it1->first)});
+        maxLine = std::max(maxLine, it2->first);
+        maxNum = std::max(maxNum, it2->second);
       }
     }
-    bubbleSort(sortedWords);
     if (sortedWords.empty())
     {
       return "";
     }
+    mozhegova::DynamicArray< PlacedWord > byNum(sortedWords.size());
+    countingSort(sortedWords, byNum, maxNum, false);
+    countingSort(byNum, sortedWords, maxLine, true);
     std::string result;
     for (size_t i = 0; i < sortedWords.size(); ++i)
     {
-      result += sortedWords[i].second;
+      result += *sortedWords[i].second;
       if (i < sortedWords.size() - 1)
       {
         if (sortedWords[i].first.first != sortedWords[i + 1].first.first)
@@ -113,20 +117,11 @@ namespace
 
   size_t getMaxLineNumWord(constWord & word)
   {
-    mozhegova::Xrefs xrefs = word.second;
-    if (xrefs.empty())
+    if (word.second.empty())
     {
       return 0;
     }
-    size_t maxNumWord = 1;
-    for (size_t i = 0; i < word.second.size(); ++i)
-    {
-      if (maxNumWord < word.second[i].first)
-      {
-        maxNumWord = word.second[i].first;
-      }
-    }
-    return maxNumWord;
+    return std::max< size_t >(1, word.second.back().first);
   }
 
   size_t getMaxLineNum(const mozhegova::Text & text)
@@ -144,17 +139,16 @@ namespace
 
   size_t getMaxNumWord(constWord & word)
   {
-    mozhegova::Xrefs xrefs = word.second;
-    if (xrefs.empty())
+    if (word.second.empty())
     {
       return 0;
     }
     size_t maxNumWord = 1;
-    for (size_t i = 0; i < word.second.size(); ++i)
+    for (auto it = word.second.cbegin(); it != word.second.cend(); ++it)
     {
-      if (maxNumWord < word.second[i].second)
+      if (maxNumWord < it->second)
       {
-        maxNumWord = word.second[i].second;
+        maxNumWord = it->second;
       }
     }
     return maxNumWord;
@@ -178,17 +172,10 @@ namespace
     mozhegova::Text result;
     for (auto it1 = text.cbegin(); it1 != text.cend(); ++it1)
     {
-      mozhegova::Xrefs newXrefs;
-      for (size_t i = 0; i < it1->second.size(); ++i)
-      {
-        if (it1->second[i].first >= begin && it1->second[i].first < end)
-        {
-          newXrefs.push_back(it1->second[i]);
-        }
-      }
+      mozhegova::Xrefs newXrefs = it1->second.copyLines(begin, end, begin);
       if (!newXrefs.empty())
       {
-        result[it1->first] = newXrefs;
+        result[it1->first] = std::move(newXrefs);
       }
     }
     return result;
@@ -196,23 +183,22 @@ namespace
 
   void insertTextTo(mozhegova::Text & text1, const mozhegova::Text & text2, size_t n, size_t begin, size_t end)
   {
-    mozhegova::Text temp = extractSubstring(text2, begin, end);
-    for (auto it1 = text1.begin(); it1 != text1.end(); ++it1)
+    mozhegova::Text temp;
+    for (auto it2 = text2.cbegin(); it2 != text2.cend(); ++it2)
     {
-      for (size_t i = 0; i < it1->second.size(); ++i)
+      mozhegova::Xrefs lines = it2->second.copyLines(begin, end, n);
+      if (!lines.empty())
       {
-        if (it1->second[i].first >= n)
-        {
-          it1->second[i].first += (end - begin);
-        }
+        temp[it2->first] = std::move(lines);
       }
     }
+    for (auto it1 = text1.begin(); it1 != text1.end(); ++it1)
+    {
+      it1->second.insertLines(n, end - begin);
+    }
     for (auto it2 = temp.cbegin(); it2 != temp.cend(); ++it2)
     {
-      for (size_t i = 0; i < it2->second.size(); ++i)
-      {
-        text1[it2->first].push_back({it2->second[i].first + n - begin, it2->second[i].second});
-      }
+      text1[it2->first].merge(it2->second);
     }
   }
 
@@ -220,21 +206,12 @@ namespace
   {
     for (auto it1 = text.begin(); it1 != text.end();)
     {
-      bool isDeleted = false;
-      for (size_t i = 0; i < it1->second.size(); ++i)
+      it1->second.removeLines(begin, end);
+      if (it1->second.empty())
       {
-        if (it1->second[i].first >= begin && it1->second[i].first < end)
-        {
-          it1 = text.erase(it1);
-          isDeleted = true;
-          break;
-        }
-        else if (it1->second[i].first >= end)
-        {
-          it1->second[i].first -= (end - begin);
-        }
+        it1 = text.erase(it1);
       }
-      if (!isDeleted)
+      else
       {
         ++it1;
       }
@@ -426,22 +403,15 @@ void mozhegova::sideMergeTexts(std::istream & in, Texts & texts)
   const Text & text1 = it1->second;
   const Text & text2 = it2->second;
   Text temp1 = text1;
-  Text temp2 = text2;
-  size_t maxLines = std::max(getMaxLineNum(text1), getMaxLineNum(text2));
   size_t maxNum = getMaxNum(text1);
-  for (size_t line = 1; line <= maxLines; ++line)
+  for (auto it1 = text2.cbegin(); it1 != text2.cend(); ++it1)
   {
-    for (auto it1 = temp2.begin(); it1 != temp2.end(); ++it1)
+    Xrefs shifted;
+    for (auto it2 = it1->second.cbegin(); it2 != it1->second.cend(); ++it2)
     {
-      for (size_t i = 0; i < it1->second.size(); ++i)
-      {
-        if (it1->second[i].first == line)
-        {
-          it1->second[i].second += maxNum;
-          temp1[it1->first].push_back(it1->second[i]);
-        }
-      }
+      shifted.push_back({it2->first, it2->second + maxNum});
     }
+    temp1[it1->first].merge(shifted);
   }
   texts[newText] = std::move(temp1);
 }
@@ -482,10 +452,27 @@ void mozhegova::invertLines(std::istream & in, Texts & texts)
   size_t maxLine = getMaxLineNum(text);
   for (auto it1 = text.begin(); it1 != text.end(); ++it1)
   {
-    for (size_t i = 0; i < it1->second.size(); ++i)
+    DynamicArray< WordPos > positions;
+    for (auto it2 = it1->second.cbegin(); it2 != it1->second.cend(); ++it2)
     {
-      it1->second[i].first = maxLine - it1->second[i].first + 1;
+      positions.push_back({maxLine - it2->first + 1, it2->second});
     }
+    Xrefs inverted;
+    size_t runEnd = positions.size();
+    while (runEnd > 0)
+    {
+      size_t runBegin = runEnd - 1;
+      while (runBegin > 0 && positions[runBegin - 1].first == positions[runBegin].first)
+      {
+        --runBegin;
+      }
+      for (size_t i = runBegin; i < runEnd; ++i)
+      {
+        inverted.push_back(positions[i]);
+      }
+      runEnd = runBegin;
+    }
+    it1->second = std::move(inverted);
   }
 }
 
@@ -499,20 +486,30 @@ void mozhegova::invertWords(std::istream & in, Texts & texts)
     throw std::runtime_error("<INVALID COMMAND>");
   }
   Text & text = it->second;
-  size_t maxLines = getMaxLineNum(text);
   size_t maxNum = getMaxNum(text);
-  for (size_t line = 1; line <= maxLines; ++line)
+  for (auto it1 = text.begin(); it1 != text.end(); ++it1)
   {
-    for (auto it1 = text.begin(); it1 != text.end(); ++it1)
+    DynamicArray< WordPos > positions;
+    for (auto it2 = it1->second.cbegin(); it2 != it1->second.cend(); ++it2)
     {
-      for (size_t i = 0; i < it1->second.size(); ++i)
+      positions.push_back({it2->first, maxNum - it2->second + 1});
+    }
+    Xrefs inverted;
+    size_t runBegin = 0;
+    while (runBegin < positions.size())
+    {
+      size_t runEnd = runBegin + 1;
+      while (runEnd < positions.size() && positions[runEnd].first == positions[runBegin].first)
       {
-        if (it1->second[i].first == line)
-        {
-          it1->second[i].second = maxNum - it1->second[i].second + 1;
-        }
+        ++runEnd;
+      }
+      for (size_t i = runEnd; i > runBegin; --i)
+      {
+        inverted.push_back(positions[i - 1]);
       }
+      runBegin = runEnd;
     }
+    it1->second = std::move(inverted);
   }
 }
 
@@ -12,7 +12,7 @@
 int main(int argc, char * argv[])
 {
   using namespace mozhegova;
-  HashTable< std::string, HashTable< std::string, DynamicArray< std::pair< size_t, size_t > > > > texts;
+  Texts texts;
   if (argc == 2 && std::string(argv[1]) == "--help")
   {
     printHelp(std::cout);
@@ -0,0 +1,217 @@
+#include <boost/test/unit_test.hpp>
+#include <algorithm>
+#include <random>
+#include <sstream>
+#include <vector>
+#include "commands.hpp"
+#include "xrefs.hpp"
+
+namespace
+{
+  using Model = std::vector< mozhegova::WordPos >;
+
+  Model toModel(const mozhegova::Xrefs & xrefs)
+  {
+    return Model(xrefs.cbegin(), xrefs.cend());
+  }
+
+  Model randomPostings(std::mt19937 & gen, size_t count, size_t lines)
+  {
+    std::uniform_int_distribution< size_t > line(1, lines);
+    std::uniform_int_distribution< size_t > word(1, 12);
+    Model result;
+    for (size_t i = 0; i < count; ++i)
+    {
+      result.push_back({line(gen), word(gen)});
+    }
+    std::sort(result.begin(), result.end());
+    return result;
+  }
+
+  mozhegova::Xrefs fromModel(const Model & model)
+  {
+    mozhegova::Xrefs result;
+    for (auto && pos: model)
+    {
+      result.push_back(pos);
+    }
+    return result;
+  }
+
+  void checkSame(const mozhegova::Xrefs & xrefs, const Model & model)
+  {
+    BOOST_TEST(xrefs.size() == model.size());
+    BOOST_TEST(xrefs.empty() == model.empty());
+    BOOST_TEST((toModel(xrefs) == model));
+    if (!model.empty())
+    {
+      BOOST_TEST((xrefs.back() == model.back()));
+    }
+  }
+
+  void checkAppend(mozhegova::Xrefs & xrefs, Model & model)
+  {
+    mozhegova::WordPos next = {model.empty() ? 1 : model.back().first + 1, 1};
+    xrefs.push_back(next);
+    model.push_back(next);
+    checkSame(xrefs, model);
+  }
+
+  const size_t sizes[] = {0, 1, 63, 64, 65, 200, 517};
+}
+
+BOOST_AUTO_TEST_CASE(push_back_test)
+{
+  std::mt19937 gen(1);
+  Model model = randomPostings(gen, 300, 100);
+  mozhegova::Xrefs xrefs = fromModel(model);
+  checkSame(xrefs, model);
+
+  Model extra = randomPostings(gen, 200, 120);
+  std::shuffle(extra.begin(), extra.end(), gen);
+  for (auto && pos: extra)
+  {
+    xrefs.push_back(pos);
+    model.insert(std::upper_bound(model.begin(), model.end(), pos), pos);
+  }
+  checkSame(xrefs, model);
+  checkAppend(xrefs, model);
+}
+
+BOOST_AUTO_TEST_CASE(merge_test)
+{
+  std::mt19937 gen(2);
+  for (size_t lhsSize: sizes)
+  {
+    for (size_t rhsSize: sizes)
+    {
+      Model lhs = randomPostings(gen, lhsSize, 80);
+      Model rhs = randomPostings(gen, rhsSize, 80);
+      if (rhsSize % 2 == 1)
+      {
+        for (auto && pos: rhs)
+        {
+          pos.first += 80;
+        }
+      }
+      mozhegova::Xrefs xrefs = fromModel(lhs);
+      xrefs.merge(fromModel(rhs));
+      Model model;
+      std::merge(lhs.begin(), lhs.end(), rhs.begin(), rhs.end(), std::back_inserter(model));
+      checkSame(xrefs, model);
+      checkAppend(xrefs, model);
+    }
+  }
+}
+
+BOOST_AUTO_TEST_CASE(copy_lines_test)
+{
+  std::mt19937 gen(3);
+  for (size_t size: sizes)
+  {
+    Model source = randomPostings(gen, size, 60);
+    mozhegova::Xrefs xrefs = fromModel(source);
+    for (size_t begin = 1; begin <= 61; begin += 6)
+    {
+      for (size_t end = begin; end <= 62; end += 11)
+      {
+        size_t to = 1 + (begin * 7 + end) % 30;
+        Model model;
+        for (auto && pos: source)
+        {
+          if (pos.first >= begin && pos.first < end)
+          {
+            model.push_back({pos.first - begin + to, pos.second});
+          }
+        }
+        mozhegova::Xrefs copy = xrefs.copyLines(begin, end, to);
+        checkSame(copy, model);
+        checkAppend(copy, model);
+      }
+    }
+    checkSame(xrefs, source);
+  }
+}
+
+BOOST_AUTO_TEST_CASE(insert_lines_test)
+{
+  std::mt19937 gen(4);
+  for (size_t size: sizes)
+  {
+    Model source = randomPostings(gen, size, 60);
+    for (size_t at = 1; at <= 62; at += 5)
+    {
+      for (size_t count = 0; count <= 9; count += 3)
+      {
+        mozhegova::Xrefs xrefs = fromModel(source);
+        xrefs.insertLines(at, count);
+        Model model = source;
+        for (auto && pos: model)
+        {
+          if (pos.first >= at)
+          {
+            pos.first += count;
+          }
+        }
+        checkSame(xrefs, model);
+        checkAppend(xrefs, model);
+      }
+    }
+  }
+}
+
+BOOST_AUTO_TEST_CASE(remove_lines_test)
+{
+  std::mt19937 gen(5);
+  for (size_t size: sizes)
+  {
+    Model source = randomPostings(gen, size, 60);
+    for (size_t begin = 1; begin <= 61; begin += 4)
+    {
+      for (size_t end = begin; end <= 62; end += 7)
+      {
+        mozhegova::Xrefs xrefs = fromModel(source);
+        xrefs.removeLines(begin, end);
+        Model model;
+        for (auto && pos: source)
+        {
+          if (pos.first < begin)
+          {
+            model.push_back(pos);
+          }
+          else if (pos.first >= end)
+          {
+            model.push_back({pos.first - (end - begin), pos.second});
+          }
+        }
+        checkSame(xrefs, model);
+        checkAppend(xrefs, model);
+      }
+    }
+  }
+}
+
+BOOST_AUTO_TEST_CASE(remove_lines_command_test)
+{
+  mozhegova::Texts texts;
+  mozhegova::Text & text = texts["t"];
+  text["one"].push_back({1, 1});
+  text["two"].push_back({1, 2});
+  text["one"].push_back({1, 3});
+  text["two"].push_back({2, 1});
+  text["three"].push_back({2, 2});
+  text["three"].push_back({3, 1});
+  text["one"].push_back({3, 2});
+  text["four"].push_back({4, 1});
+  text["one"].push_back({4, 2});
+
+  std::istringstream remove("t 2 4");
+  mozhegova::removeLines(remove, texts);
+  BOOST_TEST((texts.at("t").find("three") == texts.at("t").end()));
+  BOOST_TEST(texts.at("t").at("two").size() == 1);
+
+  std::istringstream print("t");
+  std::ostringstream out;
+  mozhegova::printText(print, out, texts);
+  BOOST_TEST(out.str() == "one two one\nfour one\n");
+}
@@ -0,0 +1,319 @@
+#include "xrefs.hpp"
+#include <memory>
+
+mozhegova::Xrefs::ConstIterator::ConstIterator():
+  xrefs_(nullptr),
+  index_(0),
+  offset_(0),
+  pos_(0, 0)
+{}
+
+mozhegova::Xrefs::ConstIterator::ConstIterator(const Xrefs * xrefs, size_t index, size_t offset):
+  xrefs_(xrefs),
+  index_(index),
+  offset_(offset),
+  pos_(0, 0)
+{
+  if (index_ < xrefs_->size_)
+  {
+    decode();
+  }
+}
+
+void mozhegova::Xrefs::ConstIterator::decode()
+{
+  size_t values[2] = {0, 0};
+  for (size_t i = 0; i < 2; ++i)
+  {
+    unsigned char byte = 0;
+    size_t shift = 0;
+    do
+    {
+      byte = xrefs_->bytes_[offset_++];
+      values[i] |= static_cast< size_t >(byte & 0x7F) << shift;
+      shift += 7;
+    }
+    while (byte & 0x80);
+  }
+  if (index_ % blockSize == 0)
+  {
+    pos_ = {values[0], values[1]};
+  }
+  else if (values[0] == 0)
+  {
+    pos_.second += values[1];
+  }
+  else
+  {
+    pos_ = {pos_.first + values[0], values[1]};
+  }
+}
+
+mozhegova::Xrefs::ConstIterator & mozhegova::Xrefs::ConstIterator::operator++()
+{
+  ++index_;
+  if (index_ < xrefs_->size_)
+  {
+    decode();
+  }
+  return *this;
+}
+
+mozhegova::Xrefs::ConstIterator mozhegova::Xrefs::ConstIterator::operator++(int)
+{
+  ConstIterator tmp = *this;
+  ++(*this);
+  return tmp;
+}
+
+const mozhegova::WordPos & mozhegova::Xrefs::ConstIterator::operator*() const
+{
+  return pos_;
+}
+
+const mozhegova::WordPos * mozhegova::Xrefs::ConstIterator::operator->() const
+{
+  return std::addressof(pos_);
+}
+
+bool mozhegova::Xrefs::ConstIterator::operator!=(const ConstIterator & rhs) const
+{
+  return !(*this == rhs);
+}
+
+bool mozhegova::Xrefs::ConstIterator::operator==(const ConstIterator & rhs) const
+{
+  return xrefs_ == rhs.xrefs_ && index_ == rhs.index_;
+}
+
+mozhegova::Xrefs::Xrefs():
+  bytes_(),
+  blocks_(),
+  size_(0),
+  last_(0, 0)
+{}
+
+mozhegova::Xrefs::ConstIterator mozhegova::Xrefs::begin() const
+{
+  return cbegin();
+}
+
+mozhegova::Xrefs::ConstIterator mozhegova::Xrefs::end() const
+{
+  return cend();
+}
+
+mozhegova::Xrefs::ConstIterator mozhegova::Xrefs::cbegin() const
+{
+  return ConstIterator(this, 0, 0);
+}
+
+mozhegova::Xrefs::ConstIterator mozhegova::Xrefs::cend() const
+{
+  return ConstIterator(this, size_, bytes_.size());
+}
+
+bool mozhegova::Xrefs::empty() const noexcept
+{
+  return size_ == 0;
+}
+
+size_t mozhegova::Xrefs::size() const noexcept
+{
+  return size_;
+}
+
+const mozhegova::WordPos & mozhegova::Xrefs::back() const
+{
+  return last_;
+}
+
+void mozhegova::Xrefs::push_back(const WordPos & pos)
+{
+  if (empty() || !(pos < last_))
+  {
+    append(pos);
+    return;
+  }
+  Xrefs single;
+  single.append(pos);
+  merge(single);
+}
+
+void mozhegova::Xrefs::merge(const Xrefs & other)
+{
+  if (other.empty())
+  {
+    return;
+  }
+  if (empty() || !(*other.cbegin() < last_))
+  {
+    for (auto it = other.cbegin(); it != other.cend(); ++it)
+    {
+      append(*it);
+    }
+    return;
+  }
+  size_t block = findBlock(*other.cbegin());
+  Xrefs result = prefix(block);
+  auto it = blockBegin(block);
+  auto otherIt = other.cbegin();
+  while (it != cend() || otherIt != other.cend())
+  {
+    if (otherIt == other.cend() || (it != cend() && !(*otherIt < *it)))
+    {
+      result.append(*it++);
+    }
+    else
+    {
+      result.append(*otherIt++);
+    }
+  }
+  *this = std::move(result);
+}
+
+mozhegova::Xrefs mozhegova::Xrefs::copyLines(size_t begin, size_t end, size_t to) const
+{
+  Xrefs result;
+  if (empty() || begin >= end)
+  {
+    return result;
+  }
+  for (auto it = blockBegin(findBlock({begin, 0})); it != cend() && it->first < end; ++it)
+  {
+    if (it->first >= begin)
+    {
+      result.append({it->first - begin + to, it->second});
+    }
+  }
+  return result;
+}
+
+void mozhegova::Xrefs::insertLines(size_t at, size_t count)
+{
+  if (empty() || last_.first < at || count == 0)
+  {
+    return;
+  }
+  size_t block = findBlock({at, 0});
+  Xrefs result = prefix(block);
+  for (auto it = blockBegin(block); it != cend(); ++it)
+  {
+    if (it->first < at)
+    {
+      result.append(*it);
+    }
+    else
+    {
+      result.append({it->first + count, it->second});
+    }
+  }
+  *this = std::move(result);
+}
+
+void mozhegova::Xrefs::removeLines(size_t begin, size_t end)
+{
+  if (empty() || last_.first < begin || begin >= end)
+  {
+    return;
+  }
+  size_t block = findBlock({begin, 0});
+  Xrefs result = prefix(block);
+  for (auto it = blockBegin(block); it != cend(); ++it)
+  {
+    if (it->first < begin)
+    {
+      result.append(*it);
+    }
+    else if (it->first >= end)
+    {
+      result.append({it->first - (end - begin), it->second});
+    }
+  }
+  *this = std::move(result);
+}
+
+void mozhegova::Xrefs::append(const WordPos & pos)
+{
+  if (size_ % blockSize == 0)
+  {
+    blocks_.push_back(bytes_.size());
+    putNumber(pos.first);
+    putNumber(pos.second);
+  }
+  else if (pos.first == last_.first)
+  {
+    putNumber(0);
+    putNumber(pos.second - last_.second);
+  }
+  else
+  {
+    putNumber(pos.first - last_.first);
+    putNumber(pos.second);
+  }
+  last_ = pos;
+  ++size_;
+}
+
+void mozhegova::Xrefs::putNumber(size_t value)
+{
+  while (value >= 0x80)
+  {
+    bytes_.push_back(static_cast< unsigned char >(value | 0x80));
+    value >>= 7;
+  }
+  bytes_.push_back(static_cast< unsigned char >(value));
+}
+
+size_t mozhegova::Xrefs::findBlock(const WordPos & pos) const
+{
+  size_t low = 0;
+  size_t high = blocks_.size();
+  while (high - low > 1)
+  {
+    size_t middle = low + (high - low) / 2;
+    if (*blockBegin(middle) < pos)
+    {
+      low = middle;
+    }
+    else
+    {
+      high = middle;
+    }
+  }
+  return low;
+}
+
+mozhegova::Xrefs::ConstIterator mozhegova::Xrefs::blockBegin(size_t block) const
+{
+  if (block >= blocks_.size())
+  {
+    return cend();
+  }
+  return ConstIterator(this, block * blockSize, blocks_[block]);
+}
+
+mozhegova::Xrefs mozhegova::Xrefs::prefix(size_t blocks) const
+{
+  Xrefs result;
+  if (blocks == 0)
+  {
+    return result;
+  }
+  for (size_t i = 0; i < blocks_[blocks]; ++i)
+  {
+    result.bytes_.push_back(bytes_[i]);
+  }
+  for (size_t i = 0; i < blocks; ++i)
+  {
+    result.blocks_.push_back(blocks_[i]);
+  }
+  auto it = blockBegin(blocks - 1);
+  for (size_t i = 1; i < blockSize; ++i)
+  {
+    ++it;
+  }
+  result.size_ = blocks * blockSize;
+  result.last_ = *it;
+  return result;
+}
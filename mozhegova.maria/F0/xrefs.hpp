@@ -0,0 +1,71 @@
+#ifndef XREFS_HPP
+#define XREFS_HPP
+
+#include <cstddef>
+#include <iterator>
+#include <utility>
+#include <dynamicArray.hpp>
+
+namespace mozhegova
+{
+  using WordPos = std::pair< size_t, size_t >;
+
+  class Xrefs
+  {
+  public:
+    static constexpr size_t blockSize = 64;
+
+    class ConstIterator: public std::iterator< std::forward_iterator_tag, WordPos >
+    {
+      friend class Xrefs;
+    public:
+      ConstIterator();
+
+      ConstIterator & operator++();
+      ConstIterator operator++(int);
+
+      const WordPos & operator*() const;
+      const WordPos * operator->() const;
+
+      bool operator!=(const ConstIterator & rhs) const;
+      bool operator==(const ConstIterator & rhs) const;
+    private:
+      const Xrefs * xrefs_;
+      size_t index_;
+      size_t offset_;
+      WordPos pos_;
+      ConstIterator(const Xrefs * xrefs, size_t index, size_t offset);
+      void decode();
+    };
+
+    Xrefs();
+
+    ConstIterator begin() const;
+    ConstIterator end() const;
+    ConstIterator cbegin() const;
+    ConstIterator cend() const;
+
+    bool empty() const noexcept;
+    size_t size() const noexcept;
+    const WordPos & back() const;
+
+    void push_back(const WordPos & pos);
+    void merge(const Xrefs & other);
+    Xrefs copyLines(size_t begin, size_t end, size_t to) const;
+    void insertLines(size_t at, size_t count);
+    void removeLines(size_t begin, size_t end);
+  private:
+    DynamicArray< unsigned char > bytes_;
+    DynamicArray< size_t > blocks_;
+    size_t size_;
+    WordPos last_;
+
+    void append(const WordPos & pos);
+    void putNumber(size_t value);
+    size_t findBlock(const WordPos & pos) const;
+    ConstIterator blockBegin(size_t block) const;
+    Xrefs prefix(size_t blocks) const;
+  };
+}
+
+#endif
@@ -0,0 +1,30 @@
+#include <bench.hpp>
+#include <string>
+#include <dynamicArray.hpp>
+#include <queue.hpp>
+#include <stack.hpp>
+
+namespace
+{
+  template< typename Container, void (Container::*Push)(const std::string &) >
+  void pushStrings(const char * name, const bench::Options & opts)
+  {
+    const std::string value(32, 'x');
+    Container container;
+    bench::Probe probe(name, "push_string");
+    for (size_t i = 0; i < opts.n; ++i)
+    {
+      (container.*Push)(value);
+    }
+    probe.stop(opts.n);
+    bench::keep(container.size());
+  }
+
+  using Array = mozhegova::DynamicArray< std::string >;
+  using Queue = mozhegova::Queue< std::string >;
+  using Stack = mozhegova::Stack< std::string >;
+
+  const bench::Registrar array("mozhegova::DynamicArray<string>", pushStrings< Array, &Array::push_back >);
+  const bench::Registrar queue("mozhegova::Queue<string>", pushStrings< Queue, &Queue::push >);
+  const bench::Registrar stack("mozhegova::Stack<string>", pushStrings< Stack, &Stack::push >);
+}
@@ -1,6 +1,17 @@
 #include <boost/test/unit_test.hpp>
 #include <hashTable.hpp>
 
+namespace
+{
+  struct SameHash
+  {
+    size_t operator()(int) const
+    {
+      return 7;
+    }
+  };
+}
+
 BOOST_AUTO_TEST_CASE(insert_emplace_access)
 {
   mozhegova::HashTable< int, std::string > table;
@@ -30,6 +41,30 @@ BOOST_AUTO_TEST_CASE(erase)
   BOOST_TEST(table.size() == 1);
 }
 
+BOOST_AUTO_TEST_CASE(colliding_keys)
+{
+  mozhegova::HashTable< int, int, SameHash > table;
+  for (int i = 0; i < 40; ++i)
+  {
+    table[i] = i;
+  }
+  for (int i = 0; i < 40; i += 3)
+  {
+    BOOST_TEST(table.erase(i) == 1);
+  }
+  for (int i = 40; i < 60; ++i)
+  {
+    BOOST_TEST(table.insert(std::make_pair(i, i)).second);
+  }
+  for (int i = 0; i < 60; ++i)
+  {
+    bool erased = i < 40 && i % 3 == 0;
+    BOOST_TEST((table.find(i) == table.end()) == erased);
+    BOOST_TEST(table.insert(std::make_pair(i, -1)).second == erased);
+  }
+  BOOST_TEST(table.size() == 60);
+}
+
 BOOST_AUTO_TEST_CASE(rehash)
 {
   mozhegova::HashTable< int, std::string > table;
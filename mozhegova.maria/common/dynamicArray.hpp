@@ -22,6 +22,7 @@ namespace mozhegova
     size_t size() const noexcept;
     void swap(DynamicArray & other) noexcept;
     void push_back(const T & value);
+    void push_back(T && value);
   private:
     size_t capacity_;
     size_t size_;
@@ -32,36 +33,37 @@ namespace mozhegova
   DynamicArray< T >::DynamicArray():
     capacity_(10),
     size_(0),
-    data_(new T[capacity_])
+    data_(allocate< T >(capacity_))
   {}
 
   template< typename T >
   DynamicArray< T >::DynamicArray(size_t size):
     capacity_(size + 10),
-    size_(size),
-    data_(new T[size])
-  {}
-
-  template< typename T >
-  DynamicArray< T >::DynamicArray(const DynamicArray & other):
-    capacity_(other.capacity_),
-    size_(other.size_),
-    data_(new T[capacity_])
+    size_(0),
+    data_(allocate< T >(capacity_))
   {
     try
     {
-      for (size_t i = 0; i < size_; i++)
+      for (; size_ < size; size_++)
       {
-        data_[i] = other.data_[i];
+        new (data_ + size_) T();
       }
     }
-    catch (const std::exception &)
+    catch (...)
     {
-      delete[] data_;
+      destroy(data_, 0, size_, capacity_);
+      deallocate(data_);
       throw;
     }
   }
 
+  template< typename T >
+  DynamicArray< T >::DynamicArray(const DynamicArray & other):
+    capacity_(other.capacity_),
+    size_(other.size_),
+    data_(copyData(other.data_, 0, other.size_, other.capacity_, other.capacity_))
+  {}
+
   template< typename T >
   DynamicArray< T >::DynamicArray(DynamicArray && other) noexcept:
     capacity_(other.capacity_),
@@ -76,7 +78,8 @@ namespace mozhegova
   template< typename T >
   DynamicArray< T >::~DynamicArray()
   {
-    delete[] data_;
+    destroy(data_, 0, size_, capacity_);
+    deallocate(data_);
   }
 
   template< typename T >
@@ -138,9 +141,31 @@ namespace mozhegova
   {
     if (size_ == capacity_)
     {
-      data_ = resize(data_, capacity_);
+      T temp(value);
+      data_ = resize(data_, 0, size_, capacity_);
+      new (data_ + size_) T(std::move(temp));
+    }
+    else
+    {
+      new (data_ + size_) T(value);
+    }
+    size_++;
+  }
+
+  template< typename T >
+  void DynamicArray< T >::push_back(T && value)
+  {
+    if (size_ == capacity_)
+    {
+      T temp(std::move(value));
+      data_ = resize(data_, 0, size_, capacity_);
+      new (data_ + size_) T(std::move(temp));
+    }
+    else
+    {
+      new (data_ + size_) T(std::move(value));
     }
-    data_[size_++] = value;
+    size_++;
   }
 }
 
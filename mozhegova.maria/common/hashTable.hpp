@@ -197,12 +197,12 @@ namespace mozhegova
       {
         return currSlot;
       }
-      currSlot = (homeSlot + i * i) % table_.size();
-      ++i;
       if (i >= table_.size())
       {
         break;
       }
+      currSlot = (homeSlot + i * i) % table_.size();
+      ++i;
     }
     return table_.size();
   }
@@ -226,7 +226,7 @@ namespace mozhegova
     {
       return 0.0;
     }
-    return size_ / table_.size();
+    return static_cast< float >(size_) / table_.size();
   }
 
   template< class Key, class Value, class Hash, class Equal >
@@ -257,6 +257,10 @@ namespace mozhegova
     size_t i = 1;
     while (table[currSlot].occupied)
     {
+      if (i >= table.size())
+      {
+        return table.size();
+      }
       currSlot = (homeSlot + i * i) % table.size();
       ++i;
     }
@@ -276,6 +280,11 @@ namespace mozhegova
       if (table_[i].occupied)
       {
         size_t newId = findIndexIn(table_[i].data.first, temp);
+        if (newId == temp.size())
+        {
+          rehash(n * 2);
+          return;
+        }
         temp[newId].data = table_[i].data;
         temp[newId].occupied = true;
         temp[newId].deleted = false;
@@ -354,7 +363,7 @@ namespace mozhegova
   template< class... Args >
   std::pair< HashIter< Key, Value, Hash, Equal >, bool > HashTable< Key, Value, Hash, Equal >::emplace(Args &&... args)
   {
-    if ((size_ + 1) / table_.size() > max_load_factor_)
+    if (static_cast< float >(size_ + 1) / table_.size() > max_load_factor_)
     {
       rehash(table_.size() * 2);
     }
@@ -373,6 +382,10 @@ namespace mozhegova
       {
         firstDeleted = currSlot;
       }
+      if (i >= table_.size())
+      {
+        break;
+      }
       currSlot = (homeSlot + i * i) % table_.size();
       ++i;
     }
@@ -380,6 +393,11 @@ namespace mozhegova
     {
       currSlot = firstDeleted;
     }
+    else if (table_[currSlot].occupied || table_[currSlot].deleted)
+    {
+      rehash(table_.size() * 2);
+      return emplace(std::move(pair));
+    }
     table_[currSlot].data = std::move(pair);
     table_[currSlot].occupied = true;
     table_[currSlot].deleted = false;
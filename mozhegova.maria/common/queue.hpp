@@ -38,29 +38,16 @@ namespace mozhegova
     size_(0),
     capacity_(1),
     first_(0),
-    data_(new T[capacity_])
+    data_(allocate< T >(capacity_))
   {}
 
   template< typename T >
   Queue< T >::Queue(const Queue< T > & other):
     size_(other.size_),
     capacity_(other.capacity_),
-    first_(other.first_),
-    data_(new T[capacity_])
-  {
-    try
-    {
-      for (size_t i = 0; i < size_; i++)
-      {
-        data_[i] = other.data_[i];
-      }
-    }
-    catch (const std::exception &)
-    {
-      delete[] data_;
-      throw;
-    }
-  }
+    first_(0),
+    data_(copyData(other.data_, other.first_, other.size_, other.capacity_, other.capacity_))
+  {}
 
   template< typename T >
   Queue< T >::Queue(Queue< T > && other) noexcept:
@@ -78,7 +65,8 @@ namespace mozhegova
   template< typename T >
   Queue< T >::~Queue()
   {
-    delete[] data_;
+    destroy(data_, first_, size_, capacity_);
+    deallocate(data_);
   }
 
   template< typename T >
@@ -108,9 +96,16 @@ namespace mozhegova
   {
     if (size_ == capacity_)
     {
-      data_ = resize(data_, capacity_);
+      T temp(value);
+      data_ = resize(data_, first_, size_, capacity_);
+      first_ = 0;
+      new (data_ + size_) T(std::move(temp));
+    }
+    else
+    {
+      new (data_ + (first_ + size_) % capacity_) T(value);
     }
-    data_[size_++] = value;
+    size_++;
   }
 
   template< typename T >
@@ -120,6 +115,7 @@ namespace mozhegova
     {
       throw std::logic_error("empty queue");
     }
+    data_[first_].~T();
     first_ = (first_ + 1) % capacity_;
     size_--;
   }
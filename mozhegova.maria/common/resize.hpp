@@ -2,32 +2,77 @@
 #define RESIZE_HPP
 
 #include <cstddef>
+#include <new>
 #include <stdexcept>
+#include <utility>
 
 namespace mozhegova
 {
   template< typename T >
-  T * resize(T * data, size_t & capacity)
+  T * allocate(size_t capacity)
   {
+    return static_cast< T * >(::operator new(capacity * sizeof(T)));
+  }
+
+  template< typename T >
+  void destroy(T * data, size_t first, size_t size, size_t capacity) noexcept
+  {
+    for (size_t i = 0; i < size; i++)
+    {
+      data[(first + i) % capacity].~T();
+    }
+  }
+
+  template< typename T >
+  void deallocate(T * data) noexcept
+  {
+    ::operator delete(data);
+  }
+
+  template< typename T >
+  T * copyData(const T * data, size_t first, size_t size, size_t capacity, size_t newCapacity)
+  {
+    T * temp = allocate< T >(newCapacity);
+    size_t i = 0;
+    try
     {
-      size_t size = capacity * 2;
-      T * temp = new T[size];
-      try
+      for (; i < size; i++)
       {
-        for (size_t i = 0; i < capacity; i++)
-        {
-          temp[i] = data[i];
-        }
+        new (temp + i) T(data[(first + i) % capacity]);
       }
-      catch (...)
+    }
+    catch (...)
+    {
+      destroy(temp, 0, i, newCapacity);
+      deallocate(temp);
+      throw;
+    }
+    return temp;
+  }
+
+  template< typename T >
+  T * resize(T * data, size_t first, size_t size, size_t & capacity)
+  {
+    size_t newCapacity = capacity == 0 ? 1 : capacity * 2;
+    T * temp = allocate< T >(newCapacity);
+    size_t i = 0;
+    try
+    {
+      for (; i < size; i++)
       {
-        delete[] temp;
-        throw;
+        new (temp + i) T(std::move_if_noexcept(data[(first + i) % capacity]));
       }
-      capacity *= 2;
-      delete[] data;
-      return temp;
     }
+    catch (...)
+    {
+      destroy(temp, 0, i, newCapacity);
+      deallocate(temp);
+      throw;
+    }
+    destroy(data, first, size, capacity);
+    deallocate(data);
+    capacity = newCapacity;
+    return temp;
   }
 }
 
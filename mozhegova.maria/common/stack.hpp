@@ -36,28 +36,15 @@ namespace mozhegova
   Stack< T >::Stack():
     size_(0),
     capacity_(1),
-    data_(new T[capacity_])
+    data_(allocate< T >(capacity_))
   {}
 
   template< typename T >
   Stack< T >::Stack(const Stack< T > & other):
     size_(other.size_),
     capacity_(other.capacity_),
-    data_(new T[capacity_])
-  {
-    try
-    {
-      for (size_t i = 0; i < size_; i++)
-      {
-        data_[i] = other.data_[i];
-      }
-    }
-    catch(const std::exception &)
-    {
-      delete[] data_;
-      throw;
-    }
-  }
+    data_(copyData(other.data_, 0, other.size_, other.capacity_, other.capacity_))
+  {}
 
   template< typename T >
   Stack< T >::Stack(Stack< T > && other) noexcept:
@@ -73,7 +60,8 @@ namespace mozhegova
   template< typename T >
   Stack< T >::~Stack()
   {
-    delete[] data_;
+    destroy(data_, 0, size_, capacity_);
+    deallocate(data_);
   }
 
   template< typename T >
@@ -103,9 +91,15 @@ namespace mozhegova
   {
     if (size_ == capacity_)
     {
-      data_ = resize(data_, capacity_);
+      T temp(value);
+      data_ = resize(data_, 0, size_, capacity_);
+      new (data_ + size_) T(std::move(temp));
+    }
+    else
+    {
+      new (data_ + size_) T(value);
     }
-    data_[size_++] = value;
+    size_++;
   }
 
   template< typename T >
@@ -115,7 +109,7 @@ namespace mozhegova
     {
       throw std::logic_error("empty stack");
     }
-    size_--;
+    data_[--size_].~T();
   }
 
   template< typename T >
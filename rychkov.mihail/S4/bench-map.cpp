@@ -0,0 +1,41 @@
+#include <bench.hpp>
+#include <cstddef>
+#include <functional>
+#include <utility>
+#include <vector>
+#include <map.hpp>
+
+namespace
+{
+  void run_bulk(const char* name, const bench::Options& opts)
+  {
+    using map_type = rychkov::Map< int, int >;
+    std::vector< std::pair< const int, int > > sorted;
+    sorted.reserve(opts.n);
+    for (int key: bench::sequentialKeys(opts.n))
+    {
+      sorted.emplace_back(key, key);
+    }
+    {
+      bench::Probe probe(name, "build_sorted");
+      map_type map(sorted.begin(), sorted.end());
+      probe.stop(opts.n);
+      bench::keep(map.size());
+    }
+    bench::Probe probe(name, "build_tagged");
+    map_type map(rychkov::sorted_unique, sorted.begin(), sorted.end());
+    probe.stop(opts.n);
+    bench::keep(map.size());
+  }
+
+  template< size_t N >
+  using fanout_map = rychkov::Map< int, int, std::less<>, N >;
+
+  const bench::Registrar map("rychkov::MapBase", bench::runMap< rychkov::Map< int, int > >);
+  const bench::Registrar bulk("rychkov::MapBase<bulk>", run_bulk);
+  const bench::Registrar fanout4("rychkov::MapBase<N=4>", bench::runMap< fanout_map< 4 > >);
+  const bench::Registrar fanout8("rychkov::MapBase<N=8>", bench::runMap< fanout_map< 8 > >);
+  const bench::Registrar fanout16("rychkov::MapBase<N=16>", bench::runMap< fanout_map< 16 > >);
+  const bench::Registrar fanout32("rychkov::MapBase<N=32>", bench::runMap< fanout_map< 32 > >);
+  const bench::Registrar fanout64("rychkov::MapBase<N=64>", bench::runMap< fanout_map< 64 > >);
+}
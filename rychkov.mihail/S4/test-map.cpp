@@ -4,6 +4,9 @@
 #include <chrono>
 #include <algorithm>
 #include <iterator>
+#include <vector>
+#include <list>
+#include <map>
 #include <boost/test/unit_test.hpp>
 #include <mem_checker.hpp>
 #include <map.hpp>
@@ -100,5 +103,225 @@ BOOST_AUTO_TEST_CASE(random_test)
     BOOST_TEST(set.size() == size);
   }
 }
+namespace
+{
+  template< size_t N >
+  void check_bulk_load(size_t count)
+  {
+    struct Wrapper
+    {
+      int value;
+      bool operator<(Wrapper rhs) const noexcept
+      {
+        return value < rhs.value;
+      }
+    };
+    using set_type = rychkov::Set< rychkov::MemChecker< Wrapper >, std::less<>, N >;
+    rychkov::MemTrack< Wrapper > observer{};
+    std::vector< rychkov::MemChecker< Wrapper > > data;
+    for (size_t i = 0; i < count; i++)
+    {
+      data.push_back(Wrapper{static_cast< int >(i * 2)});
+    }
+    auto equal_values = [](const rychkov::MemChecker< Wrapper >& lhs, const rychkov::MemChecker< Wrapper >& rhs)
+    {
+      return lhs.value == rhs.value;
+    };
+
+    set_type set(data.begin(), data.end());
+    BOOST_TEST(set.size() == count);
+    BOOST_TEST(std::equal(set.begin(), set.end(), data.begin(), data.end(), equal_values));
+    BOOST_TEST(std::equal(set.rbegin(), set.rend(), data.rbegin(), data.rend(), equal_values));
+
+    set_type copy = set;
+    BOOST_TEST(std::equal(copy.begin(), copy.end(), data.begin(), data.end(), equal_values));
+
+    for (size_t i = 0; i < count; i++)
+    {
+      set.insert(Wrapper{static_cast< int >(i * 2 + 1)});
+    }
+    BOOST_TEST(set.size() == 2 * count);
+    int expected = 0;
+    for (auto i = set.begin(); i != set.end(); ++i, expected++)
+    {
+      BOOST_TEST(i->value == expected);
+    }
+
+    std::list< rychkov::MemChecker< Wrapper > > sorted(data.begin(), data.end());
+    set_type tagged(rychkov::sorted_unique, sorted.begin(), sorted.end());
+    for (size_t i = 0; i < count; i += 2)
+    {
+      BOOST_TEST(tagged.erase(data[i]) == 1);
+    }
+    for (size_t i = 1; i < count; i += 2)
+    {
+      BOOST_TEST(tagged.contains(data[i]));
+    }
+    BOOST_TEST(tagged.size() == count / 2);
+  }
+
+  template< class Map, class Expected >
+  void check_bounds(const Map& map, const Expected& expected, int from, int to)
+  {
+    auto equal_keys = [](const typename Map::value_type& lhs, const typename Expected::value_type& rhs)
+    {
+      return lhs.first == rhs.first;
+    };
+    BOOST_TEST(std::equal(map.begin(), map.end(), expected.begin(), expected.end(), equal_keys));
+    for (int key = from; key < to; key++)
+    {
+      auto k = static_cast< typename Map::key_type >(key);
+      BOOST_TEST(std::distance(map.begin(), map.lower_bound(k))
+          == std::distance(expected.begin(), expected.lower_bound(k)));
+      BOOST_TEST(std::distance(map.begin(), map.upper_bound(k))
+          == std::distance(expected.begin(), expected.upper_bound(k)));
+      BOOST_TEST(map.contains(k) == (expected.find(k) != expected.end()));
+    }
+  }
+  template< class Map, class Expected >
+  void check_packed_search(std::minstd_rand& gen, int range)
+  {
+    std::uniform_int_distribution< int > dist(0, range - 1);
+    Map map;
+    Expected expected;
+    for (int i = 0; i < range; i++)
+    {
+      int key = dist(gen);
+      map.insert({static_cast< typename Map::key_type >(key), i});
+      expected.insert({static_cast< typename Map::key_type >(key), i});
+    }
+    check_bounds(map, expected, -1, range + 1);
+    for (int i = 0; i < range / 2; i++)
+    {
+      auto key = static_cast< typename Map::key_type >(dist(gen));
+      BOOST_TEST(map.erase(key) == expected.erase(key));
+    }
+    check_bounds(map, expected, -1, range + 1);
+  }
+}
+
+BOOST_AUTO_TEST_CASE(bulk_load_test)
+{
+  for (size_t count = 0; count < 80; count++)
+  {
+    check_bulk_load< 2 >(count);
+    check_bulk_load< 3 >(count);
+    check_bulk_load< 10 >(count);
+  }
+  check_bulk_load< 2 >(5000);
+  check_bulk_load< 10 >(5000);
+
+  rychkov::Map< int, char > unsorted = {{3, 'a'}, {1, 'b'}, {2, 'c'}};
+  BOOST_TEST(unsorted.begin()->first == 1);
+  rychkov::Map< int, char > duplicated = {{1, 'a'}, {1, 'b'}, {2, 'c'}};
+  BOOST_TEST(duplicated.size() == 2);
+  BOOST_TEST(duplicated.at(1) == 'a');
+  rychkov::MultiMap< int, char > multi = {{1, 'a'}, {1, 'b'}, {2, 'c'}};
+  BOOST_TEST(multi.size() == 3);
+  BOOST_TEST(std::next(multi.begin())->second == 'b');
+}
+namespace
+{
+  struct Relocated
+  {
+    static size_t moves;
+    static int tracked_below;
+    int value;
+
+    Relocated(int val) noexcept:
+      value(val)
+    {}
+    Relocated(const Relocated& rhs) noexcept:
+      value(rhs.value)
+    {}
+    Relocated(Relocated&& rhs) noexcept:
+      value(rhs.value)
+    {
+      moves += (value < tracked_below);
+    }
+    Relocated& operator=(const Relocated& rhs) noexcept
+    {
+      value = rhs.value;
+      return *this;
+    }
+    Relocated& operator=(Relocated&& rhs) noexcept
+    {
+      value = rhs.value;
+      moves += (value < tracked_below);
+      return *this;
+    }
+    bool operator<(const Relocated& rhs) const noexcept
+    {
+      return value < rhs.value;
+    }
+  };
+  size_t Relocated::moves = 0;
+  int Relocated::tracked_below = 0;
+
+  template< size_t N >
+  size_t moves_on_append(size_t count, size_t node_fill)
+  {
+    std::vector< Relocated > data;
+    for (size_t i = 0; i < count; i++)
+    {
+      data.emplace_back(static_cast< int >(i));
+    }
+    rychkov::Set< Relocated, std::less<>, N > set;
+    set.insert(rychkov::sorted_unique, data.begin(), data.end(), node_fill);
+    Relocated last{static_cast< int >(count)};
+    Relocated::moves = 0;
+    Relocated::tracked_below = last.value;
+    set.insert(last);
+    size_t moves = Relocated::moves;
+    BOOST_TEST(set.size() == count + 1);
+    BOOST_TEST((--set.end())->value == static_cast< int >(count));
+    return moves;
+  }
+}
+BOOST_AUTO_TEST_CASE(bulk_load_fill_test)
+{
+  BOOST_TEST(moves_on_append< 10 >(1000, 9) == 0);
+  BOOST_TEST(moves_on_append< 10 >(1000, 10) > 0);
+  BOOST_TEST(moves_on_append< 3 >(500, 2) == 0);
+  BOOST_TEST(moves_on_append< 10 >(1000, 0) == 0);
+
+  std::vector< int > data;
+  for (int i = 0; i < 2000; i += 2)
+  {
+    data.push_back(i);
+  }
+  rychkov::Set< int, std::less<>, 10 > set(rychkov::sorted_unique, data.begin(), data.end());
+  for (int i = 1; i < 2000; i += 2)
+  {
+    set.insert(i);
+  }
+  BOOST_TEST(set.size() == 2000);
+  int expected = 0;
+  for (auto i = set.begin(); i != set.end(); ++i, expected++)
+  {
+    BOOST_TEST(*i == expected);
+  }
+}
+BOOST_AUTO_TEST_CASE(packed_search_test)
+{
+  std::minstd_rand gen(7);
+  check_packed_search< rychkov::Map< int, int >, std::map< int, int > >(gen, 500);
+  check_packed_search< rychkov::Map< int, int, std::less<>, 7 >, std::map< int, int > >(gen, 500);
+  check_packed_search< rychkov::Map< unsigned, int, std::less< unsigned >, 16 >, std::map< unsigned, int > >(gen, 500);
+  check_packed_search< rychkov::MultiMap< short, int, std::less<>, 9 >, std::multimap< short, int > >(gen, 100);
+  check_packed_search< rychkov::MultiMap< double, int, std::less<>, 3 >, std::multimap< double, int > >(gen, 100);
+  check_packed_search< rychkov::Map< double, int, std::less<>, 12 >, std::map< double, int > >(gen, 300);
+
+  std::vector< int > storage(64);
+  rychkov::Set< const int*, std::less<>, 8 > pointers;
+  for (size_t i = 0; i < storage.size(); i += 3)
+  {
+    pointers.insert(storage.data() + i);
+  }
+  BOOST_TEST(pointers.size() == 22);
+  BOOST_TEST(*pointers.lower_bound(storage.data() + 4) == storage.data() + 6);
+  BOOST_TEST(*pointers.upper_bound(storage.data() + 6) == storage.data() + 9);
+  BOOST_TEST((pointers.find(storage.data() + 5) == pointers.end()));
+}
 
 BOOST_AUTO_TEST_SUITE_END()
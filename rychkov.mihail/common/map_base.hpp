@@ -8,6 +8,7 @@
 #include "map_base/construct_destruct.hpp"
 #include "map_base/emplace_impl.hpp"
 #include "map_base/insert.hpp"
+#include "map_base/bulk_load.hpp"
 #include "map_base/access.hpp"
 #include "map_base/indexers.hpp"
 #include "map_base/search.hpp"
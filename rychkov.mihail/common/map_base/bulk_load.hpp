@@ -0,0 +1,159 @@
+#ifndef MAP_BASE_BULK_LOAD_HPP
+#define MAP_BASE_BULK_LOAD_HPP
+
+#include "declaration.hpp"
+
+#include <iterator>
+#include <limits>
+#include <type_traits>
+
+template< class K, class T, class C, size_t N, bool IsSet, bool IsMulti >
+template< class InputIter >
+void rychkov::MapBase< K, T, C, N, IsSet, IsMulti >::insert(sorted_unique_t, InputIter from, InputIter to)
+{
+  insert(sorted_unique, from, to, bulk_node_fill);
+}
+template< class K, class T, class C, size_t N, bool IsSet, bool IsMulti >
+template< class InputIter >
+void rychkov::MapBase< K, T, C, N, IsSet, IsMulti >::insert(sorted_unique_t, InputIter from, InputIter to,
+      size_type node_fill)
+{
+  using category = typename std::iterator_traits< InputIter >::iterator_category;
+  if (empty() && std::is_base_of< std::forward_iterator_tag, category >::value)
+  {
+    bulk_load(from, std::distance(from, to), node_fill);
+    return;
+  }
+  insert_range(from, to, std::false_type{});
+}
+template< class K, class T, class C, size_t N, bool IsSet, bool IsMulti >
+template< class InputIter >
+void rychkov::MapBase< K, T, C, N, IsSet, IsMulti >::insert_range(InputIter from, InputIter to, std::false_type)
+{
+  for (; from != to; ++from)
+  {
+    insert(*from);
+  }
+}
+template< class K, class T, class C, size_t N, bool IsSet, bool IsMulti >
+template< class ForwardIter >
+void rychkov::MapBase< K, T, C, N, IsSet, IsMulti >::insert_range(ForwardIter from, ForwardIter to, std::true_type)
+{
+  if (empty() && is_sorted_range(from, to))
+  {
+    bulk_load(from, std::distance(from, to));
+    return;
+  }
+  insert_range(from, to, std::false_type{});
+}
+template< class K, class T, class C, size_t N, bool IsSet, bool IsMulti >
+template< class ForwardIter >
+bool rychkov::MapBase< K, T, C, N, IsSet, IsMulti >::is_sorted_range(ForwardIter from, ForwardIter to) const
+{
+  if (from == to)
+  {
+    return true;
+  }
+  for (ForwardIter prev = from++; from != to; prev = from++)
+  {
+    if (IsMulti ? compare_keys(get_key(*from), get_key(*prev)) : !compare_keys(get_key(*prev), get_key(*from)))
+    {
+      return false;
+    }
+  }
+  return true;
+}
+template< class K, class T, class C, size_t N, bool IsSet, bool IsMulti >
+template< class ForwardIter >
+void rychkov::MapBase< K, T, C, N, IsSet, IsMulti >::bulk_load(ForwardIter from, size_type count,
+      size_type node_fill)
+{
+  if (count == 0)
+  {
+    return;
+  }
+  node_fill = (node_fill == 0 ? 1 : (node_fill > node_capacity ? node_capacity : node_fill));
+  constexpr size_t max_tree_depth = std::numeric_limits< size_t >::digits + 1;
+  size_t total_children[max_tree_depth];
+  size_t nodes[max_tree_depth];
+  size_t next_node[max_tree_depth] = {};
+  size_t levels = 0;
+  for (size_t children = count + 1; levels == 0 || nodes[levels - 1] > 1; children = nodes[levels++])
+  {
+    size_t packed = (children + node_fill) / (node_fill + 1);
+    total_children[levels] = children;
+    nodes[levels] = (packed < children / 2 ? packed : children / 2);
+  }
+
+  node_type* root = bulk_load_node(from, levels - 1, total_children, nodes, next_node);
+  root->parent = fake_root();
+  fake_children_[0] = root;
+  cached_begin_ = root;
+  while (!cached_begin_->isleaf())
+  {
+    cached_begin_ = cached_begin_->children[0];
+  }
+  cached_rbegin_ = root;
+  while (!cached_rbegin_->isleaf())
+  {
+    cached_rbegin_ = cached_rbegin_->children[cached_rbegin_->size()];
+  }
+  size_ = count;
+}
+template< class K, class T, class C, size_t N, bool IsSet, bool IsMulti >
+template< class ForwardIter >
+typename rychkov::MapBase< K, T, C, N, IsSet, IsMulti >::node_type*
+    rychkov::MapBase< K, T, C, N, IsSet, IsMulti >::bulk_load_node(ForwardIter& from, size_t level,
+      const size_t* total_children, const size_t* nodes, size_t* next_node)
+{
+  size_t index = next_node[level]++;
+  size_t nchildren = total_children[level] / nodes[level] + (index < total_children[level] % nodes[level] ? 1 : 0);
+  node_type* children[node_capacity + 1];
+  size_t built = 0;
+  node_type* result = new node_type;
+  try
+  {
+    for (size_t i = 0; i < nchildren; i++)
+    {
+      if (level != 0)
+      {
+        children[built] = bulk_load_node(from, level - 1, total_children, nodes, next_node);
+        built++;
+      }
+      if (i + 1 < nchildren)
+      {
+        result->emplace_back(*from);
+        ++from;
+      }
+    }
+  }
+  catch (...)
+  {
+    for (size_t i = 0; i < built; i++)
+    {
+      delete_subtree(children[i]);
+    }
+    delete result;
+    throw;
+  }
+  for (size_t i = 0; i < built; i++)
+  {
+    result->children[i] = children[i];
+    children[i]->parent = result;
+  }
+  return result;
+}
+template< class K, class T, class C, size_t N, bool IsSet, bool IsMulti >
+void rychkov::MapBase< K, T, C, N, IsSet, IsMulti >::delete_subtree(node_type* node) noexcept
+{
+  if (!node->isleaf())
+  {
+    for (size_t i = 0; i <= node->size(); i++)
+    {
+      delete_subtree(node->children[i]);
+    }
+  }
+  delete node;
+}
+
+#endif
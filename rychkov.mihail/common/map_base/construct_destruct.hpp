@@ -47,8 +47,10 @@ rychkov::MapBase< K, T, C, N, IsSet, IsMulti >::MapBase(MapBase&& rhs)
 }
 template< class K, class T, class C, size_t N, bool IsSet, bool IsMulti >
 rychkov::MapBase< K, T, C, N, IsSet, IsMulti >::MapBase(const MapBase& rhs):
-  MapBase(rhs.begin(), rhs.end(), rhs.comp_)
-{}
+  MapBase(rhs.comp_)
+{
+  bulk_load(rhs.begin(), rhs.size_, node_capacity);
+}
 template< class K, class T, class C, size_t N, bool IsSet, bool IsMulti >
 rychkov::MapBase< K, T, C, N, IsSet, IsMulti >::MapBase
     (std::initializer_list< value_type > init, value_compare compare):
@@ -59,10 +61,15 @@ template< class InputIt >
 rychkov::MapBase< K, T, C, N, IsSet, IsMulti >::MapBase(InputIt from, InputIt to, value_compare compare):
   MapBase(std::move(compare))
 {
-  for (; from != to; ++from)
-  {
-    insert(*from);
-  }
+  insert(from, to);
+}
+template< class K, class T, class C, size_t N, bool IsSet, bool IsMulti >
+template< class InputIt >
+rychkov::MapBase< K, T, C, N, IsSet, IsMulti >::MapBase(sorted_unique_t, InputIt from, InputIt to,
+      value_compare compare):
+  MapBase(std::move(compare))
+{
+  insert(sorted_unique, from, to);
 }
 template< class K, class T, class C, size_t N, bool IsSet, bool IsMulti >
 rychkov::MapBase< K, T, C, N, IsSet, IsMulti >&
@@ -3,6 +3,9 @@
 
 #include <utility>
 #include <memory>
+#include <functional>
+#include <iterator>
+#include <type_traits>
 #include <type_traits.hpp>
 #include "node.hpp"
 #include "iterator.hpp"
@@ -23,11 +26,27 @@ namespace rychkov
     auto clear_p = const_cast< Member* >(std::addressof(fake_member));
     return reinterpret_cast< Base* >(reinterpret_cast< char* >(clear_p) - offset);
   }
+  struct sorted_unique_t
+  {
+    explicit sorted_unique_t() = default;
+  };
+  constexpr sorted_unique_t sorted_unique{};
+
   namespace details
   {
     template< class R, class K1, class C, class... Exclude >
     using transparent_compare_key_t = std::enable_if_t< conjunction_v< !std::is_same< remove_cvref_t< K1 >,
               Exclude >::value... > && is_transparent_v< C >, R >;
+
+    template< class C, class K >
+    struct is_plain_less: std::false_type
+    {};
+    template< class K >
+    struct is_plain_less< std::less<>, K >: std::true_type
+    {};
+    template< class K >
+    struct is_plain_less< std::less< K >, K >: std::true_type
+    {};
   }
 
   template< class K, class T, class C, size_t N, bool IsSet, bool IsMulti >
@@ -85,6 +104,8 @@ namespace rychkov
     MapBase(std::initializer_list< value_type > init, value_compare compare = {});
     template< class InputIt >
     MapBase(InputIt from, InputIt to, value_compare compare = {});
+    template< class InputIt >
+    MapBase(sorted_unique_t, InputIt from, InputIt to, value_compare compare = {});
     ~MapBase();
     MapBase& operator=(const MapBase& rhs);
     MapBase& operator=(MapBase&& rhs) noexcept(noexcept(swap(std::declval< MapBase& >())));
@@ -196,6 +217,10 @@ namespace rychkov
         insert(const_iterator hint, V&& value);
     template< class InputIter >
     void insert(InputIter from, InputIter to);
+    template< class InputIter >
+    void insert(sorted_unique_t, InputIter from, InputIter to);
+    template< class InputIter >
+    void insert(sorted_unique_t, InputIter from, InputIter to, size_type node_fill);
     void insert(std::initializer_list< value_type > list);
 
     template< bool IsSet2 = IsSet >
@@ -223,6 +248,7 @@ namespace rychkov
   private:
     static constexpr size_t node_capacity = N;
     static constexpr size_t node_middle = (node_capacity + 1) / 2;
+    static constexpr size_t bulk_node_fill = (node_capacity > 1 ? node_capacity - 1 : 1);
     using node_type = MapBaseNode< real_value_type, node_capacity >;
     using node_size_type = typename node_type::size_type;
 
@@ -241,6 +267,17 @@ namespace rychkov
         node_size_type ins_point, const_iterator& hint);
     static void correct_erase_result(const_iterator to, const_iterator from, iterator& result, bool will_be_replaced);
 
+    template< class K1 >
+    using is_packed_search = std::integral_constant< bool, node_type::has_packed_keys
+        && details::is_plain_less< C, key_type >::value && std::is_same< K1, key_type >::value >;
+    template< class K1 >
+    node_size_type node_lower_bound(const node_type& node, const K1& key, bool& equal, std::false_type) const;
+    template< class K1 >
+    node_size_type node_lower_bound(const node_type& node, const K1& key, bool& equal, std::true_type) const;
+    template< class K1 >
+    node_size_type node_upper_bound(const node_type& node, const K1& key, std::false_type) const;
+    template< class K1 >
+    node_size_type node_upper_bound(const node_type& node, const K1& key, std::true_type) const;
     template< class K1 >
     std::pair< const_iterator, const_iterator > lower_bound_impl(const K1& key) const;
     template< class K1 >
@@ -252,6 +289,26 @@ namespace rychkov
     template< class K1 >
     std::pair< const_iterator, bool > correct_hint(const_reverse_iterator hint, const K1& key) const;
 
+    template< class InputIter >
+    using is_bulk_loadable = std::integral_constant< bool, std::is_base_of< std::forward_iterator_tag,
+          typename std::iterator_traits< InputIter >::iterator_category >::value
+        && (std::is_same< remove_cvref_t< typename std::iterator_traits< InputIter >::value_type >, value_type >::value
+          || std::is_same< remove_cvref_t< typename std::iterator_traits< InputIter >::value_type >,
+            real_value_type >::value) >;
+
+    template< class InputIter >
+    void insert_range(InputIter from, InputIter to, std::false_type);
+    template< class ForwardIter >
+    void insert_range(ForwardIter from, ForwardIter to, std::true_type);
+    template< class ForwardIter >
+    bool is_sorted_range(ForwardIter from, ForwardIter to) const;
+    template< class ForwardIter >
+    void bulk_load(ForwardIter from, size_type count, size_type node_fill = bulk_node_fill);
+    template< class ForwardIter >
+    static node_type* bulk_load_node(ForwardIter& from, size_t level, const size_t* total_children,
+        const size_t* nodes, size_t* next_node);
+    static void delete_subtree(node_type* node) noexcept;
+
     template< class... Args >
     std::pair< iterator, bool > emplace_hint_impl(std::pair< const_iterator, bool > hint, Args&&... args);
     template< bool IsSet2 = IsSet, class K1, class... Args >
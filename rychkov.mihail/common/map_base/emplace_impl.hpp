@@ -151,7 +151,7 @@ void rychkov::MapBase< K, T, C, N, IsSet, IsMulti >::devide(node_type& left, nod
   else
   {
     to_insert.emplace_back(std::move(left[node_middle]));
-    for (node_size_type i = node_middle + 1; i < ins_point; i++)
+    for (node_size_type i = node_middle + 1; (i < ins_point) && (i < node_capacity); i++)
     {
       right.emplace_back(std::move(left[i]));
       right.children[right.size()] = left.children[i + 1];
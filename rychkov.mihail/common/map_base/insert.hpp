@@ -265,10 +265,7 @@ template< class K, class T, class C, size_t N, bool IsSet, bool IsMulti >
 template< class InputIter >
 void rychkov::MapBase< K, T, C, N, IsSet, IsMulti >::insert(InputIter from, InputIter to)
 {
-  for (; from != to; ++from)
-  {
-    insert(*from);
-  }
+  insert_range(from, to, is_bulk_loadable< InputIter >{});
 }
 template< class K, class T, class C, size_t N, bool IsSet, bool IsMulti >
 void rychkov::MapBase< K, T, C, N, IsSet, IsMulti >::insert(std::initializer_list< value_type > list)
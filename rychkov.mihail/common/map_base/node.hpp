@@ -4,17 +4,68 @@
 #include <cstddef>
 #include <utility>
 #include <memory>
+#include <type_traits>
 #include <type_tools.hpp>
 
 namespace rychkov
 {
+  namespace details
+  {
+    template< class Value >
+    struct node_key
+    {
+      using type = Value;
+      static const type& get(const Value& value) noexcept
+      {
+        return value;
+      }
+    };
+    template< class K, class T >
+    struct node_key< std::pair< K, T > >
+    {
+      using type = K;
+      static const type& get(const std::pair< K, T >& value) noexcept
+      {
+        return value.first;
+      }
+    };
+    constexpr size_t node_keys_chunk = 8;
+    template< class Key, size_t N >
+    using is_packable_key = std::integral_constant< bool, (N >= node_keys_chunk)
+        && (std::is_arithmetic< Key >::value || std::is_pointer< Key >::value) >;
+
+    template< class Key, size_t N, bool Packed = is_packable_key< Key, N >::value >
+    struct node_keys
+    {
+      Key data[(N + node_keys_chunk - 1) / node_keys_chunk * node_keys_chunk] = {};
+      void set(size_t i, const Key& key) noexcept
+      {
+        data[i] = key;
+      }
+      void move(size_t to, size_t from) noexcept
+      {
+        data[to] = data[from];
+      }
+    };
+    template< class Key, size_t N >
+    struct node_keys< Key, N, false >
+    {
+      void set(size_t, const Key&) noexcept
+      {}
+      void move(size_t, size_t) noexcept
+      {}
+    };
+  }
+
   template< class Value, size_t N >
   class MapBaseNode
   {
   public:
     using value_type = Value;
+    using key_type = typename details::node_key< Value >::type;
     using size_type = select_size_type_t< N >;
     static constexpr size_t node_capacity = N;
+    static constexpr bool has_packed_keys = details::is_packable_key< key_type, N >::value;
 
     static_assert(N >= 2, "");
 
@@ -34,7 +85,7 @@ namespace rychkov
     }
     const value_type& operator[](size_type i) const
     {
-      return *(reinterpret_cast< value_type* >(data_) + i);
+      return *(reinterpret_cast< const value_type* >(data_) + i);
     }
     bool empty() const noexcept
     {
@@ -56,6 +107,11 @@ namespace rychkov
     {
       return children[0] == nullptr;
     }
+    template< bool Packed = has_packed_keys >
+    const std::enable_if_t< Packed, key_type >* keys() const noexcept
+    {
+      return keys_.data;
+    }
 
     template< class... Args >
     void emplace(size_type newPlace, Args&&... args)
@@ -64,9 +120,11 @@ namespace rychkov
       {
         new(std::addressof(operator[](i))) value_type{std::move(operator[](i - 1))};
         operator[](i - 1).~value_type();
+        keys_.move(i, i - 1);
         children[i + 1] = children[i];
       }
       new(std::addressof(operator[](newPlace))) value_type{std::forward< Args >(args)...};
+      keys_.set(newPlace, details::node_key< Value >::get(operator[](newPlace)));
       if (newPlace == 0)
       {
         children[1] = (size_ == 0 ? nullptr : children[0]);
@@ -88,6 +146,7 @@ namespace rychkov
     {
       operator[](i).~value_type();
       new(std::addressof(operator[](i))) value_type{std::forward< Args >(args)...};
+      keys_.set(i, details::node_key< Value >::get(operator[](i)));
     }
     void erase(size_type i)
     {
@@ -96,6 +155,7 @@ namespace rychkov
       {
         new(std::addressof(operator[](j - 1))) value_type{std::move(operator[](j))};
         operator[](j).~value_type();
+        keys_.move(j - 1, j);
         children[j] = children[j + 1];
       }
       size_--;
@@ -106,6 +166,7 @@ namespace rychkov
     }
   private:
     size_type size_ = 0;
+    details::node_keys< key_type, node_capacity > keys_;
     alignas(value_type) unsigned char data_[node_capacity * sizeof(value_type)];
   };
 }
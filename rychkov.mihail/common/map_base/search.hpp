@@ -33,6 +33,92 @@ const typename rychkov::MapBase< K, T, C, N, IsSet, IsMulti >::key_type&
   return key;
 }
 
+template< class K, class T, class C, size_t N, bool IsSet, bool IsMulti >
+template< class K1 >
+typename rychkov::MapBase< K, T, C, N, IsSet, IsMulti >::node_size_type
+    rychkov::MapBase< K, T, C, N, IsSet, IsMulti >::node_lower_bound
+    (const node_type& node, const K1& key, bool& equal, std::false_type) const
+{
+  node_size_type i = 0;
+  for (; i < node.size(); i++)
+  {
+    if (compare_keys(key, get_key(node[i])))
+    {
+      return i;
+    }
+    if (!compare_keys(get_key(node[i]), key))
+    {
+      equal = true;
+      return i;
+    }
+  }
+  return i;
+}
+template< class K, class T, class C, size_t N, bool IsSet, bool IsMulti >
+template< class K1 >
+typename rychkov::MapBase< K, T, C, N, IsSet, IsMulti >::node_size_type
+    rychkov::MapBase< K, T, C, N, IsSet, IsMulti >::node_lower_bound
+    (const node_type& node, const K1& key, bool& equal, std::true_type) const
+{
+  const key_type* keys = node.keys();
+  const unsigned size = node.size();
+  unsigned result = 0;
+  for (unsigned from = 0; from < size; from += details::node_keys_chunk, keys += details::node_keys_chunk)
+  {
+    const unsigned left = size - from;
+    unsigned count = 0;
+    for (unsigned i = 0; i < details::node_keys_chunk; i++)
+    {
+      count += (i < left) & compare_keys(keys[i], key);
+    }
+    result += count;
+    if (count < details::node_keys_chunk)
+    {
+      break;
+    }
+  }
+  equal = (result < size) && !compare_keys(key, node.keys()[result]);
+  return result;
+}
+template< class K, class T, class C, size_t N, bool IsSet, bool IsMulti >
+template< class K1 >
+typename rychkov::MapBase< K, T, C, N, IsSet, IsMulti >::node_size_type
+    rychkov::MapBase< K, T, C, N, IsSet, IsMulti >::node_upper_bound
+    (const node_type& node, const K1& key, std::false_type) const
+{
+  node_size_type i = 0;
+  while ((i < node.size()) && !compare_keys(key, get_key(node[i])))
+  {
+    i++;
+  }
+  return i;
+}
+template< class K, class T, class C, size_t N, bool IsSet, bool IsMulti >
+template< class K1 >
+typename rychkov::MapBase< K, T, C, N, IsSet, IsMulti >::node_size_type
+    rychkov::MapBase< K, T, C, N, IsSet, IsMulti >::node_upper_bound
+    (const node_type& node, const K1& key, std::true_type) const
+{
+  const key_type* keys = node.keys();
+  const unsigned size = node.size();
+  unsigned result = 0;
+  for (unsigned from = 0; from < size; from += details::node_keys_chunk, keys += details::node_keys_chunk)
+  {
+    const unsigned left = size - from;
+    unsigned count = 0;
+    for (unsigned i = 0; i < details::node_keys_chunk; i++)
+    {
+      count += (i < left) & !compare_keys(key, keys[i]);
+    }
+    result += count;
+    if (count < details::node_keys_chunk)
+    {
+      break;
+    }
+  }
+  return result;
+}
+
 template< class K, class T, class C, size_t N, bool IsSet, bool IsMulti >
 template< class K1 >
 std::pair< typename rychkov::MapBase< K, T, C, N, IsSet, IsMulti >::const_iterator,
@@ -43,44 +129,25 @@ std::pair< typename rychkov::MapBase< K, T, C, N, IsSet, IsMulti >::const_iterat
   {
     return {end(), end()};
   }
-  const_iterator left = {fake_children_[0], 0}, right = end();
+  const_iterator right = end();
+  node_type* node = fake_children_[0];
   while (true)
   {
-    if (compare_keys(key, get_key(*left)))
+    bool equal = false;
+    node_size_type i = node_lower_bound(*node, key, equal, is_packed_search< K1 >{});
+    if (equal && !IsMulti)
     {
-      right = left;
-      if (left.node_->isleaf())
-      {
-        return {left, left};
-      }
-      left = {left.node_->children[left.pointed_], 0};
+      return {{node, i}, {node, i}};
     }
-    else if (!compare_keys(get_key(*left), key))
+    if (i < node->size())
     {
-      if (IsMulti)
-      {
-        right = left;
-        if (left.node_->isleaf())
-        {
-          return {left, left};
-        }
-        left = {left.node_->children[left.pointed_], 0};
-        continue;
-      }
-      return {left, left};
+      right = {node, i};
     }
-    else
+    if (node->isleaf())
     {
-      left.pointed_++;
-      if (left.pointed_ >= left.node_->size())
-      {
-        if (left.node_->isleaf())
-        {
-          return {left, right};
-        }
-        left = {left.node_->children[left.pointed_], 0};
-      }
+      return {{node, i}, right};
     }
+    node = node->children[i];
   }
 }
 template< class K, class T, class C, size_t N, bool IsSet, bool IsMulti >
@@ -92,30 +159,20 @@ typename rychkov::MapBase< K, T, C, N, IsSet, IsMulti >::const_iterator
   {
     return end();
   }
-  const_iterator left = {fake_children_[0], 0}, right = end();
+  const_iterator right = end();
+  node_type* node = fake_children_[0];
   while (true)
   {
-    node_size_type i = 0;
-    while (i < left.node_->size())
+    node_size_type i = node_upper_bound(*node, key, is_packed_search< K1 >{});
+    if (i < node->size())
     {
-      if (compare_keys(key, get_key(left.node_->operator[](i))))
-      {
-        right = {left.node_, i};
-        if (left.node_->isleaf())
-        {
-          return right;
-        }
-        left = {left.node_->children[i], 0};
-        i = 0;
-        continue;
-      }
-      i++;
+      right = {node, i};
     }
-    if (left.node_->isleaf())
+    if (node->isleaf())
     {
       return right;
     }
-    left = {left.node_->children[i], 0};
+    node = node->children[i];
   }
 }
 